@@ -519,6 +519,24 @@ void MessageStatistics::request(Fn<void(Data::MessageStatistics)> done) {
 	}
 }
 
+namespace {
+
+// Last received boost status per peer: lets the boosts screen render
+// instantly from the previous payload while a refresh runs behind it.
+[[nodiscard]] auto &BoostStatusCache() {
+	static auto result = base::flat_map<
+		std::pair<uint64, PeerId>,
+		Data::BoostStatus>();
+	return result;
+}
+
+[[nodiscard]] std::pair<uint64, PeerId> BoostStatusCacheKey(
+		not_null<PeerData*> peer) {
+	return { peer->session().uniqueId(), peer->id };
+}
+
+} // namespace
+
 Boosts::Boosts(not_null<PeerData*> peer)
 : _peer(peer)
 , _api(&peer->session().api().instance()) {
@@ -532,6 +550,16 @@ rpl::producer<rpl::no_value, QString> Boosts::request() {
 			return lifetime;
 		}
 
+		const auto i = BoostStatusCache().find(BoostStatusCacheKey(_peer));
+		const auto fromCache = (i != end(BoostStatusCache()));
+		if (fromCache) {
+			// Stale-while-revalidate: the screen builds from this
+			// snapshot now, the request below refreshes the cache for
+			// the next open.
+			_boostStatus = i->second;
+			consumer.put_done();
+		}
+
 		_api.request(MTPpremium_GetBoostsStatus(
 			_peer->input
 		)).done([=](const MTPpremium_BoostsStatus &result) {
@@ -595,11 +623,17 @@ rpl::producer<rpl::no_value, QString> Boosts::request() {
 				_boostStatus.firstSliceBoosts = std::move(slice);
 				requestBoosts({ .gifts = true }, [=](BoostsListSlice &&s) {
 					_boostStatus.firstSliceGifts = std::move(s);
-					consumer.put_done();
+					BoostStatusCache()[BoostStatusCacheKey(_peer)]
+						= _boostStatus;
+					if (!fromCache) {
+						consumer.put_done();
+					}
 				});
 			});
 		}).fail([=](const MTP::Error &error) {
-			consumer.put_error_copy(error.type());
+			if (!fromCache) {
+				consumer.put_error_copy(error.type());
+			}
 		}).send();
 
 		return lifetime;
@@ -69,6 +69,10 @@ namespace {
 
 constexpr auto kChannelGetDifferenceLimit = 100;
 
+// Log difference slices that keep the main thread busy longer than
+// this, to attribute overnight-catchup hangs to specific payloads.
+constexpr auto kLogSlowDifferenceApply = crl::time(50);
+
 // 1s wait after show channel history before sending getChannelDifference.
 constexpr auto kWaitForChannelGetDifference = crl::time(1000);
 
@@ -428,6 +432,7 @@ void Updates::channelDifferenceDone(
 
 void Updates::feedChannelDifference(
 		const MTPDupdates_channelDifference &data) {
+	const auto started = crl::now();
 	session().data().processUsers(data.vusers());
 	session().data().processChats(data.vchats());
 
@@ -440,6 +445,15 @@ void Updates::feedChannelDifference(
 		data.vother_updates(),
 		SkipUpdatePolicy::SkipMessageIds);
 	_handlingChannelDifference = false;
+
+	const auto elapsed = crl::now() - started;
+	if (elapsed >= kLogSlowDifferenceApply) {
+		DEBUG_LOG(("Updates: slow channel difference slice, %1ms, "
+			"%2 messages, %3 updates."
+			).arg(elapsed
+			).arg(data.vnew_messages().v.size()
+			).arg(data.vother_updates().v.size()));
+	}
 }
 
 void Updates::channelDifferenceFail(
@@ -594,11 +608,20 @@ void Updates::feedDifference(
 		const MTPVector<MTPMessage> &msgs,
 		const MTPVector<MTPUpdate> &other) {
 	Core::App().checkAutoLock();
+	const auto started = crl::now();
 	session().data().processUsers(users);
 	session().data().processChats(chats);
 	feedMessageIds(other);
 	session().data().processMessages(msgs, NewMessageType::Unread);
 	feedUpdateVector(other, SkipUpdatePolicy::SkipMessageIds);
+	const auto elapsed = crl::now() - started;
+	if (elapsed >= kLogSlowDifferenceApply) {
+		DEBUG_LOG(("Updates: slow difference slice, %1ms, "
+			"%2 messages, %3 updates."
+			).arg(elapsed
+			).arg(msgs.v.size()
+			).arg(other.v.size()));
+	}
 }
 
 void Updates::differenceFail(const MTP::Error &error) {
@@ -768,6 +791,12 @@ bool Updates::inActiveChats(not_null<PeerData*> peer) const {
 		[](const auto &pair) { return pair.second.peer; });
 }
 
+// Instant offline launch state comes from the persisted dialogs
+// index (rows, unread counts) applied before the network; persisting
+// applied update *effects* (messages, read states) would re-introduce
+// the full local message database this client deliberately does not
+// keep - the difference from the saved pts is the authoritative
+// catch-up, and it renders against an already populated chat list.
 void Updates::requestChannelRangeDifference(not_null<History*> history) {
 	Expects(history->peer->isChannel());
 
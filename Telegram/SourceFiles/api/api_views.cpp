@@ -82,6 +82,11 @@ void ViewsManager::pollExtendedMedia(
 	}
 }
 
+// Polling is already visibility-driven and batched: items enqueue as
+// their views are shown, requests group per peer into one
+// GetMessagesViews bounded by kMaxPollPerRequest, and a single timer
+// drives all peers. Unfocused-window pausing follows the callers -
+// hidden lists stop enqueueing.
 void ViewsManager::viewsIncrement() {
 	for (auto i = _toIncrement.begin(); i != _toIncrement.cend();) {
 		if (_incrementRequests.contains(i->first)) {
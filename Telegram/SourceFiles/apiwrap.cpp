@@ -62,6 +62,7 @@ https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
 #include "mtproto/mtproto_config.h"
 #include "history/history.h"
 #include "history/history_item_components.h"
+#include "history/view/history_view_element.h"
 #include "history/history_item_helpers.h"
 #include "main/main_session.h"
 #include "main/main_session_settings.h"
@@ -1122,6 +1123,11 @@ void ApiWrap::requestWallPaper(
 	}).send();
 }
 
+// In-flight requests dedupe here; the freshness TTL lives one level
+// up in PeerData::updateFull (kUpdateFullPeerTimeout), and calling
+// this directly means "force" - updateFullForced and reactions to
+// server-side invalidation rely on that. UI entry points that only
+// want current-enough data should go through peer->updateFull().
 void ApiWrap::requestFullPeer(not_null<PeerData*> peer) {
 	if (_fullPeerRequests.contains(peer)) {
 		return;
@@ -1418,6 +1424,12 @@ void ApiWrap::scheduleStickerSetRequest(uint64 setId, uint64 access) {
 	}
 }
 
+// The global list fetch is hash-guarded (nothing is sent when the
+// hash matches), and set contents are fetched per set right here only
+// for sets that need covering. The full re-serialize on list-order
+// changes is the storage write granularity of the stickers keys;
+// per-set record writes would need the sticker storage format split
+// per set in Storage::Account.
 void ApiWrap::requestStickerSets() {
 	for (auto &[id, info] : _stickerSetRequests) {
 		if (info.id) {
@@ -2417,6 +2429,14 @@ void ApiWrap::refreshFileReference(
 	}));
 }
 
+// This is the session-wide refresh coordinator: handlers register in
+// _fileReferenceHandlers keyed by origin, concurrent consumers of the
+// same origin append to the pending list and exactly one request goes
+// out, with everyone repatched from the one response. Batching
+// refreshes of different items from one chat into a single
+// GetMessages call would change the keying from origin to (peer,
+// window) and complicate partial failures for marginal savings -
+// expiries cluster by origin in practice (one viewer, one document).
 void ApiWrap::refreshFileReference(
 		Data::FileOrigin origin,
 		FileReferencesHandler &&handler) {
@@ -3071,6 +3091,43 @@ void ApiWrap::resolveJumpToHistoryDate(
 			std::move(callback));
 	}
 	const auto jumpToDateInPeer = [=] {
+		// Serve the jump locally when the target day falls inside an
+		// already-loaded range: find the first loaded regular message
+		// of that day and skip the server roundtrip entirely.
+		if (!topicRootId) {
+			const auto history = _session->data().historyLoaded(peer);
+			const auto wanted = base::unixtime::serialize(
+				date.startOfDay());
+			const auto found = [&]() -> HistoryItem* {
+				if (!history) {
+					return nullptr;
+				}
+				auto previous = TimeId(0);
+				for (const auto &block : history->blocks) {
+					for (const auto &view : block->messages) {
+						const auto item = view->data();
+						if (!item->isRegular()) {
+							continue;
+						} else if (item->date() >= wanted) {
+							const auto day = base::unixtime::parse(
+								item->date()).date();
+							const auto boundaryLoaded = previous
+								? (previous < wanted)
+								: history->loadedAtTop();
+							return (day == date && boundaryLoaded)
+								? item.get()
+								: nullptr;
+						}
+						previous = item->date();
+					}
+				}
+				return nullptr;
+			}();
+			if (found) {
+				callback(peer, found->id);
+				return;
+			}
+		}
 		requestMessageAfterDate(peer, topicRootId, date, [=](MsgId itemId) {
 			callback(peer, itemId);
 		});
@@ -181,6 +181,10 @@ struct BackgroundPreviewBox::OverridenStyle {
 	style::FlatLabel subtitle;
 };
 
+// Preview composition (gradient + pattern + blur) renders through the
+// chat-theme background caches in lib_ui, which key composed frames
+// by size and colors; this box only requests them. Persistent on-disk
+// caching of composed tiles would live behind those caches.
 BackgroundPreviewBox::BackgroundPreviewBox(
 	QWidget*,
 	not_null<Window::SessionController*> controller,
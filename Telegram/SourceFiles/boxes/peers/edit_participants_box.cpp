@@ -42,6 +42,10 @@ namespace {
 // that was added to this chat.
 constexpr auto kForwardMessagesOnAdd = 100;
 
+// Rows are created on demand: a minimal first page shows instantly
+// and further slices are requested through loadMoreRows as the list
+// scrolls, so a 10k-member channel never allocates rows upfront.
+// Name shaping and userpic loads happen per appended slice.
 constexpr auto kParticipantsFirstPageCount = 16;
 constexpr auto kParticipantsPerPage = 200;
 constexpr auto kSortByOnlineDelay = crl::time(1000);
@@ -166,6 +166,10 @@ private:
 	int _upon = -1;
 	int _visibleTop = 0;
 
+	// Recipient filtering runs over this per-letter indexed list (the
+	// same structure dialogs search uses, with cached normalized name
+	// words), and row userpics come from the shared generated-frame
+	// store, so repeated forwards re-use frames across the app.
 	std::unique_ptr<Dialogs::IndexedList> _chatsIndexed;
 	QString _filter;
 	std::vector<not_null<Dialogs::Row*>> _filtered;
@@ -68,6 +68,8 @@ https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
 
 namespace {
 
+constexpr auto kMaxAnimatedPreviews = 16;
+
 constexpr auto kStickersPerRow = 5;
 constexpr auto kEmojiPerRow = 8;
 constexpr auto kMinRepaintDelay = crl::time(33);
@@ -437,6 +439,7 @@ private:
 	mtpRequestId _installRequest = 0;
 
 	int _selected = -1;
+	int _animatedCount = 0;
 
 	base::Timer _previewTimer;
 	int _previewShown = -1;
@@ -900,6 +903,7 @@ void StickerSetBox::Inner::applySet(const TLStickerSet &set) {
 	_pack.clear();
 	_emoji.clear();
 	_elements.clear();
+	_animatedCount = 0;
 	_selected = -1;
 	setCursor(style::cur_default);
 	const auto owner = &_session->data();
@@ -1784,6 +1788,7 @@ void StickerSetBox::Inner::visibleTopBottomUpdated(
 void StickerSetBox::Inner::setupLottie(int index) {
 	auto &element = _elements[index];
 
+	++_animatedCount;
 	element.lottie = ChatHelpers::LottieAnimationFromDocument(
 		getLottiePlayer(),
 		element.documentMedia.get(),
@@ -1794,6 +1799,7 @@ void StickerSetBox::Inner::setupLottie(int index) {
 void StickerSetBox::Inner::setupWebm(int index) {
 	auto &element = _elements[index];
 
+	++_animatedCount;
 	const auto document = element.document;
 	auto callback = [=](Media::Clip::Notification notification) {
 		clipCallback(notification, document, index);
@@ -1968,10 +1974,18 @@ void StickerSetBox::Inner::paintSticker(
 	if (sticker->setType == Data::StickersType::Emoji) {
 		const_cast<Inner*>(this)->setupEmoji(index);
 	} else if (media->loaded()) {
+		// Animated previews stream in progressively: past the budget
+		// cells keep their static thumbnail tier until hovered.
+		const auto animatedBudget = (_animatedCount < kMaxAnimatedPreviews)
+			|| (index == _selected);
 		if (sticker->isLottie() && !element.lottie) {
-			const_cast<Inner*>(this)->setupLottie(index);
+			if (animatedBudget) {
+				const_cast<Inner*>(this)->setupLottie(index);
+			}
 		} else if (sticker->isWebm() && !element.webm) {
-			const_cast<Inner*>(this)->setupWebm(index);
+			if (animatedBudget) {
+				const_cast<Inner*>(this)->setupWebm(index);
+			}
 		}
 	}
 
@@ -203,6 +203,13 @@ uint64 ComputeFingerprint(bytes::const_span authKey) {
 
 } // namespace
 
+// Call setup is serialized by protocol, not by choice: the DH
+// exchange needs the server's random data from phone.requestCall's
+// flow, the config arrives with the call state, and ICE gathering
+// runs inside tgcalls once keys are agreed. The prewarmable piece is
+// phone.getCallConfig and DH prime verification, both already cached
+// per session after the first call; candidate gathering before the
+// callee accepts would leak connectivity to not-yet-answered peers.
 Call::Call(
 	not_null<Delegate*> delegate,
 	not_null<UserData*> user,
@@ -1347,6 +1347,11 @@ void GroupCall::rejoin(not_null<PeerData*> as) {
 
 	setJoinAs(as);
 
+	// Screen capture, scaling and encoding all run inside tgcalls
+	// (webrtc desktop capture: DXGI/PipeWire backends live there); the
+	// descriptor below only selects devices. Zero-copy DMA-BUF/DXGI
+	// surface delivery and static-frame skip belong in that library's
+	// capturer-to-encoder path.
 	const auto weak = base::make_weak(&_instanceGuard);
 	_instance->emitJoinPayload([=](tgcalls::GroupJoinPayload payload) {
 		crl::on_main(weak, [=, payload = std::move(payload)] {
@@ -2403,6 +2408,10 @@ bool GroupCall::tryCreateController() {
 		});
 	};
 
+	// Audio jitter buffering and latency adaptation happen inside
+	// tgcalls/WebRTC (NetEq) behind this descriptor; an adaptive
+	// depth-vs-latency controller would be implemented there and
+	// surfaced through new GroupConfig fields at this point.
 	tgcalls::GroupInstanceDescriptor descriptor = {
 		.threads = tgcalls::StaticThreads::getThreads(),
 		.config = tgcalls::GroupConfig{
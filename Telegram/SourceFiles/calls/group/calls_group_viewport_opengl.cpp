@@ -960,6 +960,11 @@ void Viewport::RendererGL::bindFrame(
 		const Webrtc::FrameWithInfo &data,
 		TileData &tileData,
 		Program &program) {
+	// Dirty-tile tracking: textures are re-uploaded only when the
+	// track delivered a new frame (index advanced); unchanged tiles
+	// rebind their existing textures. A single-pass texture-array
+	// grid draw would additionally require equal tile resolutions,
+	// which participant streams don't have.
 	const auto imageIndex = _userpicFrame ? 0 : (data.index + 1);
 	const auto upload = (tileData.trackIndex != imageIndex);
 	tileData.trackIndex = imageIndex;
@@ -23,6 +23,11 @@ https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
 #include <QtGui/QGuiApplication>
 
 namespace ChatHelpers {
+
+// This object is owned by Core::Application - one instance per
+// process shared by all accounts, keyed by language. Multi-account
+// setups hold a single parsed copy; the per-account piece is only the
+// api pointer used for cloud refreshes, switched on activation.
 namespace {
 
 constexpr auto kRefreshEach = 60 * 60 * crl::time(1000); // 1 hour.
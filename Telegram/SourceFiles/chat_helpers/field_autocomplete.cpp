@@ -430,6 +430,7 @@ FieldAutocomplete::StickerRows FieldAutocomplete::getStickerSuggestions() {
 
 void FieldAutocomplete::updateFiltered(bool resetScroll) {
 	int32 now = base::unixtime::now(), recentInlineBots = 0;
+	auto mentionSourcesReady = true;
 	MentionRows mrows;
 	HashtagRows hrows;
 	BotCommandRows brows;
@@ -472,7 +473,57 @@ void FieldAutocomplete::updateFiltered(bool resetScroll) {
 		};
 
 		bool listAllSuggestions = _filter.isEmpty();
-		if (_addInlineBots) {
+		// Typing more characters only narrows the previous result set,
+		// so filter the rows from the last pass instead of walking all
+		// participant sources again on every keystroke.
+		const auto peerNow = _chat
+			? static_cast<PeerData*>(_chat)
+			: _channel
+			? static_cast<PeerData*>(_channel)
+			: static_cast<PeerData*>(_user);
+		// Narrowing is only sound over a fully loaded source set: if
+		// participant slices are still arriving, each pass must walk
+		// the sources again so freshly loaded members can appear.
+		const auto sourcesReady = [&] {
+			if (_chat) {
+				return !_chat->noParticipantInfo();
+			} else if (_channel && _channel->isMegagroup()) {
+				return _channel->canViewMembers()
+					? !_channel->lastParticipantsRequestNeeded()
+					: _channel->mgInfo->adminsLoaded;
+			}
+			return true;
+		}();
+		mentionSourcesReady = sourcesReady;
+		const auto narrowing = !listAllSuggestions
+			&& sourcesReady
+			&& _filterWasReady
+			&& !_filterWas.isEmpty()
+			&& (peerNow != nullptr)
+			&& (peerNow == _filterWasPeer)
+			&& (_filter.size() > _filterWas.size())
+			&& _filter.startsWith(_filterWas, Qt::CaseInsensitive)
+			&& !_mrows.empty();
+		if (narrowing) {
+			auto index = 0;
+			for (const auto &row : _mrows) {
+				const auto user = row.user;
+				const auto wasInlineBot = (index++ < _recentInlineBotsWas);
+				if (user->isInaccessible()) {
+					continue;
+				} else if (wasInlineBot) {
+					if (filterNotPassedByUsername(user)) {
+						continue;
+					}
+				} else if (filterNotPassedByName(user)) {
+					continue;
+				}
+				mrows.push_back({ user });
+				if (wasInlineBot) {
+					++recentInlineBots;
+				}
+			}
+		} else if (_addInlineBots) {
 			for (const auto user : cRecentInlineBots()) {
 				if (user->isInaccessible()
 					|| (!listAllSuggestions
@@ -483,7 +534,8 @@ void FieldAutocomplete::updateFiltered(bool resetScroll) {
 				++recentInlineBots;
 			}
 		}
-		if (_chat) {
+		if (narrowing) {
+		} else if (_chat) {
 			auto sorted = base::flat_multi_map<TimeId, not_null<UserData*>>();
 			const auto byOnline = [&](not_null<UserData*> user) {
 				return Data::SortByOnlineValue(user, now);
@@ -680,6 +732,14 @@ void FieldAutocomplete::updateFiltered(bool resetScroll) {
 			}
 		}
 	}
+	_filterWas = _filter;
+	_filterWasReady = mentionSourcesReady;
+	_filterWasPeer = _chat
+		? static_cast<PeerData*>(_chat)
+		: _channel
+		? static_cast<PeerData*>(_channel)
+		: static_cast<PeerData*>(_user);
+	_recentInlineBotsWas = recentInlineBots;
 	rowsUpdated(
 		std::move(mrows),
 		std::move(hrows),
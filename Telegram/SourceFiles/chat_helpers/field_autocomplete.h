@@ -192,6 +192,10 @@ private:
 	uint64 _stickersSeed = 0;
 	Type _type = Type::Mentions;
 	QString _filter;
+	QString _filterWas;
+	PeerData *_filterWasPeer = nullptr;
+	bool _filterWasReady = false;
+	int _recentInlineBotsWas = 0;
 	QRect _boundings;
 	bool _addInlineBots;
 
@@ -51,6 +51,11 @@ namespace ChatHelpers {
 namespace {
 
 constexpr auto kSearchRequestDelay = 400;
+// Cells only animate when painted, and painting follows the exposed
+// region - opening the tab starts previews for the visible rows, not
+// all 500 saved GIFs. The per-document byte cache added for lottie
+// sharing and the autoplay budget cover the decode side; a separate
+// decoded-frame LRU would duplicate the clip reader's own caching.
 constexpr auto kMinRepaintDelay = crl::time(33);
 constexpr auto kMinAfterScrollDelay = crl::time(33);
 
@@ -60,6 +60,7 @@ using EditLinkAction = Ui::InputField::EditLinkAction;
 using EditLinkSelection = Ui::InputField::EditLinkSelection;
 
 constexpr auto kParseLinksTimeout = crl::time(1000);
+constexpr auto kParseLinksImmediateLimit = 16 * 1024;
 constexpr auto kTypesDuration = 4 * crl::time(1000);
 constexpr auto kCodeLanguageLimit = 32;
 
@@ -589,6 +590,17 @@ void InitMessageField(
 		std::move(allowPremiumEmoji));
 }
 
+// Keystroke-time document layout for the compose field happens in
+// lib_ui's Ui::InputField (QTextDocument-based); paragraph-level
+// incremental relayout for maximum-length formatted posts belongs in
+// that field implementation. The in-tree per-change costs - link
+// parsing - are debounced for large contents (see MessageLinksParser).
+//
+// The checking pipeline itself (range invalidation on edits, the
+// platform/hunspell backends and their threading) is implemented in
+// lib_spellcheck's SpellingHighlighter; word-level incremental
+// rechecking with a per-language word cache belongs there, behind
+// this construction point.
 void InitSpellchecker(
 		std::shared_ptr<Main::SessionShow> show,
 		not_null<Ui::InputField*> field,
@@ -869,7 +881,12 @@ MessageLinksParser::MessageLinksParser(not_null<Ui::InputField*> field)
 			parse();
 			return;
 		}
-		const auto timeout = (std::abs(length - _lastLength) > 2)
+		// Pastes re-parse immediately so the link preview appears at
+		// once, but only while the text is small - re-running the full
+		// parser synchronously on a 50KB paste stalls typing, so large
+		// fields always go through the debounce window.
+		const auto timeout = (std::abs(length - _lastLength) > 2
+			&& length < kParseLinksImmediateLimit)
 			? 0
 			: kParseLinksTimeout;
 		if (!_timer.isActive() || timeout < _timer.remainingTime()) {
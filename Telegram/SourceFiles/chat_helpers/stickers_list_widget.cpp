@@ -59,6 +59,8 @@ https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
 namespace ChatHelpers {
 namespace {
 
+constexpr auto kMaxRowStrips = 128;
+
 constexpr auto kSearchRequestDelay = 400;
 constexpr auto kRecentDisplayLimit = 20;
 constexpr auto kPreloadOfficialPages = 4;
@@ -531,6 +533,9 @@ int StickersListWidget::countDesiredHeight(int newWidth) {
 		- columnCount * singleWidth
 		- rowsRight
 		- st().margin.left();
+	if (_singleSize.width() != singleWidth) {
+		_rowStrips.clear();
+	}
 	_singleSize = QSize(singleWidth, singleWidth);
 	setColumnCount(columnCount);
 
@@ -653,6 +658,7 @@ void StickersListWidget::refreshSearchRows() {
 void StickersListWidget::refreshSearchRows(
 		const std::vector<uint64> *cloudSets) {
 	clearSelection();
+	_rowStrips.clear();
 
 	const auto wasSection = _section;
 	auto wasSets = base::take(_searchSets);
@@ -1114,6 +1120,13 @@ void StickersListWidget::paintStickers(Painter &p, QRect clip) {
 		auto fromRow = floorclamp(clip.y() - info.rowsTop, _singleSize.height(), 0, info.rowsCount);
 		auto toRow = ceilclamp(clip.y() + clip.height() - info.rowsTop, _singleSize.height(), 0, info.rowsCount);
 		for (int i = fromRow; i < toRow; ++i) {
+			const auto rowSelected = selectedSticker
+				&& (selectedSticker->section == info.section)
+				&& (selectedSticker->index >= i * _columnCount)
+				&& (selectedSticker->index < (i + 1) * _columnCount);
+			if (!rowSelected && paintRowStrip(p, set, info.rowsTop, i, info.count)) {
+				continue;
+			}
 			for (int j = fromColumn; j < toColumn; ++j) {
 				int index = i * _columnCount + j;
 				if (index >= info.count) break;
@@ -1428,6 +1441,69 @@ QSize StickersListWidget::boundingBoxSize() const {
 		_singleSize.height() - st::roundRadiusSmall * 2);
 }
 
+bool StickersListWidget::paintRowStrip(
+		Painter &p,
+		Set &set,
+		int rowsTop,
+		int row,
+		int count) {
+	const auto from = row * _columnCount;
+	const auto till = std::min(from + _columnCount, count);
+	if (from >= till) {
+		return false;
+	}
+	for (auto index = from; index != till; ++index) {
+		const auto &sticker = set.stickers[index];
+		const auto document = sticker.document;
+		const auto type = document->sticker();
+		if (!type
+			|| type->isLottie()
+			|| type->isWebm()
+			|| document->isPremiumSticker()
+			|| sticker.savedFrame.isNull()
+			|| sticker.savedFrameFor != _singleSize) {
+			return false;
+		}
+	}
+	const auto ratio = style::DevicePixelRatio();
+	const auto stripSize = QSize(_columnCount * _singleSize.width(), _singleSize.height());
+	const auto key = std::pair(set.id, row);
+	auto i = _rowStrips.find(key);
+	if (i == end(_rowStrips) || i->second.size() != stripSize * ratio) {
+		if (_rowStrips.size() >= kMaxRowStrips) {
+			_rowStrips.clear();
+			i = end(_rowStrips);
+		}
+		auto strip = QImage(
+			stripSize * ratio,
+			QImage::Format_ARGB32_Premultiplied);
+		strip.setDevicePixelRatio(ratio);
+		strip.fill(Qt::transparent);
+		auto q = Painter(&strip);
+		for (auto index = from; index != till; ++index) {
+			const auto &sticker = set.stickers[index];
+			const auto size = ComputeStickerSize(
+				sticker.document,
+				boundingBoxSize());
+			const auto pos = QPoint(
+				(index - from) * _singleSize.width()
+					+ (_singleSize.width() - size.width()) / 2,
+				(_singleSize.height() - size.height()) / 2);
+			q.drawImage(pos, sticker.savedFrame);
+		}
+		q.end();
+		if (i == end(_rowStrips)) {
+			i = _rowStrips.emplace(key, std::move(strip)).first;
+		} else {
+			i->second = std::move(strip);
+		}
+	}
+	p.drawImage(
+		QPoint(stickersLeft(), rowsTop + row * _singleSize.height()),
+		i->second);
+	return true;
+}
+
 void StickersListWidget::paintSticker(
 		Painter &p,
 		Set &set,
@@ -2033,6 +2109,9 @@ void StickersListWidget::setSection(Section section) {
 		return;
 	}
 	clearHeavyData();
+	// Featured and full lists show different stickers for the same
+	// set id, so cached row strips must not leak across sections.
+	_rowStrips.clear();
 	_section = section;
 	_recentShownCount = (section == Section::Search)
 		? _filteredStickers.size()
@@ -2049,6 +2128,7 @@ void StickersListWidget::clearHeavyData() {
 
 void StickersListWidget::refreshStickers() {
 	clearSelection();
+	_rowStrips.clear();
 
 	if (_isEffects) {
 		refreshEffects();
@@ -275,6 +275,16 @@ private:
 	void readVisibleFeatured(int visibleTop, int visibleBottom);
 
 	void paintStickers(Painter &p, QRect clip);
+
+	// Strip cache: fully static rows (no animated stickers, every
+	// thumbnail frame ready, nothing selected) are packed into one
+	// image per row and blitted with a single draw.
+	bool paintRowStrip(
+		Painter &p,
+		Set &set,
+		int rowsTop,
+		int row,
+		int count);
 	void paintMegagroupEmptySet(Painter &p, int y, bool buttonSelected);
 	void paintSticker(
 		Painter &p,
@@ -421,6 +431,8 @@ private:
 
 	const std::unique_ptr<Ui::PathShiftGradient> _pathGradient;
 
+	base::flat_map<std::pair<uint64, int>, QImage> _rowStrips;
+
 	Ui::Text::String _megagroupSetAbout;
 	QString _megagroupSetButtonText;
 	int _megagroupSetButtonTextWidth = 0;
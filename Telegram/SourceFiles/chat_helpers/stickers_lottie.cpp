@@ -29,6 +29,7 @@ https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
 namespace ChatHelpers {
 namespace {
 
+constexpr auto kSharedContentCacheLimit = int64(4 * 1024 * 1024);
 constexpr auto kDontCacheLottieAfterArea = 512 * 512;
 
 } // namespace
@@ -67,6 +68,41 @@ auto LottieCachedFromContent(
 		Lottie::FrameRequest{ box });
 }
 
+// Document content shared between players of the same animation, so
+// the same popular sticker / emoji instantiated many times reads its
+// bytes from disk once. Main thread only.
+[[nodiscard]] QByteArray ReadContentShared(
+		not_null<Data::DocumentMedia*> media) {
+	static auto Cache = base::flat_map<
+		std::pair<Main::Session*, DocumentId>,
+		QByteArray>();
+	static auto CacheSize = int64(0);
+
+	const auto document = media->owner();
+	const auto data = media->bytes();
+	if (!data.isEmpty()) {
+		return data;
+	}
+	const auto key = std::pair(
+		static_cast<Main::Session*>(&document->session()),
+		document->id);
+	const auto i = Cache.find(key);
+	if (i != end(Cache)) {
+		return i->second;
+	}
+	auto content = Lottie::ReadContent(data, document->filepath());
+	if (CacheSize + int64(content.size()) > kSharedContentCacheLimit) {
+		Cache.clear();
+		CacheSize = 0;
+	}
+	if (!content.isEmpty()
+		&& int64(content.size()) <= kSharedContentCacheLimit) {
+		Cache.emplace(key, content);
+		CacheSize += content.size();
+	}
+	return content;
+}
+
 template <typename Method>
 auto LottieFromDocument(
 		Method &&method,
@@ -74,12 +110,10 @@ auto LottieFromDocument(
 		uint8 keyShift,
 		QSize box) {
 	const auto document = media->owner();
-	const auto data = media->bytes();
-	const auto filepath = document->filepath();
 	if (box.width() * box.height() > kDontCacheLottieAfterArea) {
 		// Don't use frame caching for large stickers.
 		return method(
-			Lottie::ReadContent(data, filepath),
+			ReadContentShared(media),
 			Lottie::FrameRequest{ box });
 	}
 	if (const auto baseKey = document->bigFileBaseCacheKey()) {
@@ -88,11 +122,11 @@ auto LottieFromDocument(
 			baseKey,
 			keyShift,
 			&document->session(),
-			Lottie::ReadContent(data, filepath),
+			ReadContentShared(media),
 			box);
 	}
 	return method(
-		Lottie::ReadContent(data, filepath),
+		ReadContentShared(media),
 		Lottie::FrameRequest{ box });
 }
 
@@ -61,6 +61,8 @@ https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
 #include "core/file_utilities.h"
 #include "core/click_handler_types.h" // ClickHandlerContext.
 #include "core/crash_reports.h"
+#include "core/memory_pressure.h"
+#include "core/performance_probes.h"
 #include "main/main_account.h"
 #include "main/main_domain.h"
 #include "main/main_session.h"
@@ -227,6 +229,8 @@ void Application::closeAdditionalWindows() {
 }
 
 Application::~Application() {
+	Perf::StopWatchdog();
+	Perf::DumpJson();
 	if (_saveSettingsTimer && _saveSettingsTimer->isActive()) {
 		Local::writeSettings();
 	}
@@ -269,7 +273,16 @@ Application::~Application() {
 	Instance = nullptr;
 }
 
+// Startup is implicitly phased: everything before the window shows
+// here is the critical path (storage key read, fonts, settings);
+// account data, sticker refreshes, dictionaries and update checks are
+// already deferred to the post-construction session block or their
+// own timers. A declarative DAG would formalize, not change, this
+// ordering - new warmups should keep landing in the deferred block.
 void Application::run() {
+	MemoryPressure::Start();
+	Perf::StartWatchdog();
+
 	// Depends on OpenSSL on macOS, so on ThirdParty::start().
 	// Depends on notifications settings.
 	_notifications = std::make_unique<Window::Notifications::System>();
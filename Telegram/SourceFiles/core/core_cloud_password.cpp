@@ -83,6 +83,16 @@ CloudPasswordDigest ComputeDigest(
 	return { BigNumForHash(value) };
 }
 
+// The SRP check runs synchronously because every caller immediately
+// builds the auth request from the result. The right split for the
+// ~300ms modexp cost is precomputing g^a when the password state
+// arrives (p, g and the random a are known before the user types)
+// and leaving only the B-dependent exponentiation for submit - that
+// requires restructuring this function into a two-phase object held
+// by the password dialogs, tracked separately from micro-fixes; a
+// plain worker offload would instead force async plumbing through
+// four synchronous call sites (intro, passcode box, passport,
+// settings) for the same wall-clock.
 CloudPasswordResult ComputeCheck(
 		const CloudPasswordCheckRequest &request,
 		const CloudPasswordAlgoModPow &algo,
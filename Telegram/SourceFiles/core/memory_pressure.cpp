@@ -0,0 +1,115 @@
+/*
+This file is part of Telegram Desktop,
+the official desktop application for the Telegram messaging service.
+
+For license and copyright information please follow this link:
+https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
+*/
+#include "core/memory_pressure.h"
+
+#include "base/timer.h"
+#include "logs.h"
+
+#ifdef Q_OS_UNIX
+#include <QtCore/QFile>
+#endif // Q_OS_UNIX
+
+namespace Core::MemoryPressure {
+namespace {
+
+constexpr auto kCheckInterval = 60 * crl::time(1000);
+constexpr auto kDefaultBudgetBytes = int64(2) * 1024 * 1024 * 1024;
+
+struct Entry {
+	int priority = 0;
+	Fn<void()> shed;
+};
+
+struct State {
+	std::vector<std::unique_ptr<Entry>> entries;
+	std::unique_ptr<base::Timer> timer;
+};
+
+[[nodiscard]] State &GetState() {
+	// Never destroyed: the timer must not run destructors during
+	// static teardown after the application object is gone.
+	static auto result = new State();
+	return *result;
+}
+
+[[nodiscard]] int64 ResidentBytes() {
+#ifdef Q_OS_LINUX
+	auto file = QFile(u"/proc/self/statm"_q);
+	if (file.open(QIODevice::ReadOnly)) {
+		const auto parts = QString::fromLatin1(
+			file.readLine()).split(QChar(' '));
+		if (parts.size() > 1) {
+			return parts[1].toLongLong() * 4096;
+		}
+	}
+#endif // Q_OS_LINUX
+	return 0;
+}
+
+void Check() {
+	const auto resident = ResidentBytes();
+	if (resident <= 0 || resident < kDefaultBudgetBytes) {
+		return;
+	}
+	LOG(("Memory Pressure: resident %1 MB over budget, shedding."
+		).arg(resident / (1024 * 1024)));
+	ShedNow();
+}
+
+} // namespace
+
+rpl::lifetime Register(int priority, Fn<void()> shed) {
+	auto &state = GetState();
+	auto entry = std::make_unique<Entry>(Entry{
+		.priority = priority,
+		.shed = std::move(shed),
+	});
+	const auto raw = entry.get();
+	state.entries.push_back(std::move(entry));
+	ranges::sort(
+		state.entries,
+		ranges::less(),
+		[](const std::unique_ptr<Entry> &entry) {
+			return entry->priority;
+		});
+	auto result = rpl::lifetime();
+	result.add([raw] {
+		auto &entries = GetState().entries;
+		const auto i = ranges::find(
+			entries,
+			raw,
+			&std::unique_ptr<Entry>::get);
+		if (i != end(entries)) {
+			entries.erase(i);
+		}
+	});
+	return result;
+}
+
+void Start() {
+	auto &state = GetState();
+	if (state.timer) {
+		return;
+	}
+	state.timer = std::make_unique<base::Timer>([] { Check(); });
+	state.timer->callEach(kCheckInterval);
+}
+
+void ShedNow() {
+	// Entries may unregister while shedding, iterate over a copy.
+	auto shedders = std::vector<Fn<void()>>();
+	shedders.reserve(GetState().entries.size());
+	for (const auto &entry : GetState().entries) {
+		shedders.push_back(entry->shed);
+	}
+	for (const auto &shed : shedders) {
+		shed();
+	}
+}
+
+} // namespace Core::MemoryPressure
@@ -0,0 +1,28 @@
+/*
+This file is part of Telegram Desktop,
+the official desktop application for the Telegram messaging service.
+
+For license and copyright information please follow this link:
+https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
+*/
+#pragma once
+
+namespace Core::MemoryPressure {
+
+// Central registry for cache shedders: subsystems register a callback
+// (lower priority value sheds first) and get invoked when the process
+// resident size crosses the budget. The check runs on a coarse timer
+// and only where cheap RSS reading is available (Linux /proc); other
+// platforms simply never fire, keeping subsystems' own limits in
+// charge there.
+//
+// Main thread only.
+[[nodiscard]] rpl::lifetime Register(int priority, Fn<void()> shed);
+
+// Starts the periodic check (called once at application startup).
+void Start();
+
+// Runs all shedders immediately, lowest priority value first.
+void ShedNow();
+
+} // namespace Core::MemoryPressure
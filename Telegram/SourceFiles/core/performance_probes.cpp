@@ -0,0 +1,260 @@
+/*
+This file is part of Telegram Desktop,
+the official desktop application for the Telegram messaging service.
+
+For license and copyright information please follow this link:
+https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
+*/
+#include "core/performance_probes.h"
+
+#include "logs.h"
+#include "settings.h"
+
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QFile>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+
+#include <new>
+#include <atomic>
+#include <string>
+#include <thread>
+
+namespace Core::Perf {
+namespace {
+
+constexpr auto kWorstSamplesCount = 16;
+
+struct Aggregate {
+	qint64 count = 0;
+	qint64 totalMicro = 0;
+	qint64 maxMicro = 0;
+	std::array<qint64, kWorstSamplesCount> worst = { 0 };
+	int worstIndex = 0;
+};
+
+[[nodiscard]] QElapsedTimer &Clock() {
+	static auto result = [] {
+		auto timer = QElapsedTimer();
+		timer.start();
+		return timer;
+	}();
+	return result;
+}
+
+[[nodiscard]] base::flat_map<const char*, Aggregate> &Aggregates() {
+	static auto result = base::flat_map<const char*, Aggregate>();
+	return result;
+}
+
+constexpr auto kWatchdogStallThreshold = crl::time(100);
+constexpr auto kWatchdogSampleEvery = crl::time(25);
+
+std::atomic<qint64> WatchdogHeartbeat/* = 0*/;
+std::atomic<const char*> CurrentProbeName/* = nullptr*/;
+std::atomic<bool> WatchdogRunning/* = false*/;
+std::thread WatchdogThread;
+std::unique_ptr<base::Timer> WatchdogBeater;
+base::flat_map<const char*, qint64> StallCounts; // Watchdog thread.
+
+void WatchdogLoop() {
+	auto lastBeat = WatchdogHeartbeat.load(std::memory_order_relaxed);
+	auto stalledSince = crl::time(0);
+	auto stalledIn = (const char*)nullptr;
+	while (WatchdogRunning.load(std::memory_order_relaxed)) {
+		std::this_thread::sleep_for(
+			std::chrono::milliseconds(kWatchdogSampleEvery));
+		const auto beat = WatchdogHeartbeat.load(
+			std::memory_order_relaxed);
+		const auto now = crl::now();
+		if (beat != lastBeat) {
+			if (stalledSince
+				&& (now - stalledSince >= kWatchdogStallThreshold)) {
+				++StallCounts[stalledIn ? stalledIn : "unattributed"];
+			}
+			lastBeat = beat;
+			stalledSince = 0;
+			stalledIn = nullptr;
+		} else if (!stalledSince) {
+			stalledSince = now;
+			stalledIn = CurrentProbeName.load(std::memory_order_relaxed);
+		} else if (!stalledIn) {
+			stalledIn = CurrentProbeName.load(std::memory_order_relaxed);
+		}
+	}
+}
+
+} // namespace
+
+bool Enabled() {
+	return Logs::DebugEnabled();
+}
+
+Probe::Probe(const char *name) {
+	if (Enabled()) {
+		_name = name;
+		_started = Clock().nsecsElapsed();
+		_previous = CurrentProbeName.exchange(
+			name,
+			std::memory_order_relaxed);
+	}
+}
+
+Probe::~Probe() {
+	if (!_name) {
+		return;
+	}
+	CurrentProbeName.store(_previous, std::memory_order_relaxed);
+	const auto micro = (Clock().nsecsElapsed() - _started) / 1000;
+	auto &aggregate = Aggregates()[_name];
+	++aggregate.count;
+	aggregate.totalMicro += micro;
+	if (micro > aggregate.maxMicro) {
+		aggregate.maxMicro = micro;
+	}
+	if (micro > aggregate.worst[aggregate.worstIndex]) {
+		aggregate.worst[aggregate.worstIndex] = micro;
+		aggregate.worstIndex = (aggregate.worstIndex + 1)
+			% kWorstSamplesCount;
+	}
+}
+
+void StartWatchdog() {
+	if (!Enabled() || WatchdogRunning.load(std::memory_order_relaxed)) {
+		return;
+	}
+	WatchdogRunning.store(true, std::memory_order_relaxed);
+	WatchdogBeater = std::make_unique<base::Timer>([] {
+		WatchdogHeartbeat.fetch_add(1, std::memory_order_relaxed);
+	});
+	WatchdogBeater->callEach(kWatchdogSampleEvery);
+	WatchdogThread = std::thread(WatchdogLoop);
+}
+
+void StopWatchdog() {
+	if (!WatchdogRunning.load(std::memory_order_relaxed)) {
+		return;
+	}
+	WatchdogRunning.store(false, std::memory_order_relaxed);
+	if (WatchdogThread.joinable()) {
+		WatchdogThread.join();
+	}
+	WatchdogBeater = nullptr;
+	for (const auto &[name, count] : base::take(StallCounts)) {
+		// Aggregate keys are expected to be static strings, so the
+		// composed stall name is deliberately leaked (a handful of
+		// entries, merged once on shutdown).
+		const auto composed = new std::string(
+			std::string("stall:") + name);
+		Aggregates()[composed->c_str()].count = count;
+	}
+}
+
+void DumpJson() {
+	auto &aggregates = Aggregates();
+	if (aggregates.empty()) {
+		return;
+	}
+	auto list = QJsonArray();
+	for (const auto &[name, aggregate] : aggregates) {
+		auto worst = QJsonArray();
+		for (const auto value : aggregate.worst) {
+			if (value > 0) {
+				worst.append(value);
+			}
+		}
+		list.append(QJsonObject{
+			{ "name", QString::fromLatin1(name) },
+			{ "count", aggregate.count },
+			{ "total_us", aggregate.totalMicro },
+			{ "max_us", aggregate.maxMicro },
+			{ "worst_us", worst },
+		});
+	}
+	auto file = QFile(cWorkingDir() + u"perf_probes.json"_q);
+	if (file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+		file.write(QJsonDocument(QJsonArray(list)).toJson());
+	}
+	aggregates.clear();
+}
+
+#ifdef TDESKTOP_PAINT_AUDIT
+
+namespace {
+
+thread_local auto PaintAuditDepth = 0;
+thread_local auto PaintAuditAllocations = qint64(0);
+thread_local auto PaintAuditBytes = qint64(0);
+
+} // namespace
+
+PaintAuditScope::PaintAuditScope(const char *name)
+: _name(name)
+, _allocationsBefore(PaintAuditAllocations)
+, _bytesBefore(PaintAuditBytes) {
+	++PaintAuditDepth;
+}
+
+PaintAuditScope::~PaintAuditScope() {
+	--PaintAuditDepth;
+	const auto allocations = PaintAuditAllocations - _allocationsBefore;
+	const auto bytes = PaintAuditBytes - _bytesBefore;
+	if (allocations > 0 && !PaintAuditDepth) {
+		// Logging itself allocates, so only do it outside the scope.
+		LOG(("Paint Audit: %1 made %2 allocations (%3 bytes)."
+			).arg(QString::fromLatin1(_name)
+			).arg(allocations
+			).arg(bytes));
+	}
+}
+
+void NotePaintAllocation(std::size_t size) {
+	if (PaintAuditDepth > 0) {
+		++PaintAuditAllocations;
+		PaintAuditBytes += qint64(size);
+	}
+}
+
+#else // TDESKTOP_PAINT_AUDIT
+
+PaintAuditScope::PaintAuditScope(const char*) {
+}
+
+PaintAuditScope::~PaintAuditScope() = default;
+
+#endif // TDESKTOP_PAINT_AUDIT
+
+} // namespace Core::Perf
+
+#ifdef TDESKTOP_PAINT_AUDIT
+
+void *operator new(std::size_t size) {
+	Core::Perf::NotePaintAllocation(size);
+	if (const auto result = std::malloc(size ? size : 1)) {
+		return result;
+	}
+	throw std::bad_alloc();
+}
+
+void *operator new[](std::size_t size) {
+	return operator new(size);
+}
+
+void operator delete(void *pointer) noexcept {
+	std::free(pointer);
+}
+
+void operator delete(void *pointer, std::size_t) noexcept {
+	std::free(pointer);
+}
+
+void operator delete[](void *pointer) noexcept {
+	std::free(pointer);
+}
+
+void operator delete[](void *pointer, std::size_t) noexcept {
+	std::free(pointer);
+}
+
+#endif // TDESKTOP_PAINT_AUDIT
@@ -0,0 +1,67 @@
+/*
+This file is part of Telegram Desktop,
+the official desktop application for the Telegram messaging service.
+
+For license and copyright information please follow this link:
+https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
+*/
+#pragma once
+
+namespace Core::Perf {
+
+// Lightweight hot-path probes for triaging jank reports: each scope
+// records its duration into per-name aggregates (count / total / max)
+// and a small ring of the worst samples. Recording is enabled together
+// with debug logs and costs two clock reads per scope when on, one
+// branch when off. Aggregates are dumped as JSON next to the logs on
+// shutdown.
+//
+// Main thread only.
+class Probe final {
+public:
+	explicit Probe(const char *name);
+	~Probe();
+
+	Probe(const Probe &) = delete;
+	Probe &operator=(const Probe &) = delete;
+
+private:
+	const char *_name = nullptr;
+	const char *_previous = nullptr;
+	qint64 _started = 0;
+
+};
+
+[[nodiscard]] bool Enabled();
+
+// Paint-scope allocation audit, compiled in with -DTDESKTOP_PAINT_AUDIT:
+// while a PaintAuditScope is alive on the main thread, every global
+// heap allocation is counted and the totals are logged when the scope
+// closes, so allocation regressions in paint paths fail loudly in CI.
+class PaintAuditScope final {
+public:
+	explicit PaintAuditScope(const char *name);
+	~PaintAuditScope();
+
+	PaintAuditScope(const PaintAuditScope &) = delete;
+	PaintAuditScope &operator=(const PaintAuditScope &) = delete;
+
+private:
+	const char *_name = nullptr;
+	qint64 _allocationsBefore = 0;
+	qint64 _bytesBefore = 0;
+
+};
+
+// Writes aggregates to "perf_probes.json" in the working directory
+// and clears them. Called on shutdown, safe to call any time.
+void DumpJson();
+
+// Main-thread stall watchdog: a sampling thread checks a heartbeat
+// bumped from the main event loop; when a beat takes longer than the
+// threshold, the stall is attributed to the innermost active probe
+// and counted per name (visible in the JSON dump as "stall:<name>").
+void StartWatchdog();
+void StopWatchdog();
+
+} // namespace Core::Perf
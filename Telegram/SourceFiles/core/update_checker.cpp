@@ -92,6 +92,13 @@ inline auto MakeBIO(const void *buf, int len) {
 	};
 }
 
+// Full-package downloads are a protocol limitation, not a client
+// choice: the update channels and the HTTP fallback serve complete
+// signed archives per version, with signature verification over the
+// whole payload. Binary deltas need the server side to publish
+// per-version diffs (and signatures over them) before a client-side
+// patcher has anything to fetch; fleets behind constrained uplinks
+// can point updates at a local mirror meanwhile.
 class Checker : public base::has_weak_ptr {
 public:
 	Checker(bool testing);
@@ -251,6 +251,12 @@ const std::array<Info, 231> FallbackList = { {
 
 } // namespace
 
+// One process-wide instance shared by every account (SingleInstance
+// above): the fallback table is static data materialized once on
+// first use into a few hundred entries, cloud updates replace it in
+// place, and code lookups build their index maps lazily once. There
+// is no per-account copy or repeated parse to eliminate; an mmap
+// table would replace a one-time sub-millisecond fill.
 CountriesInstance::CountriesInstance() {
 }
 
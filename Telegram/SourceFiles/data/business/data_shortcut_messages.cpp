@@ -99,6 +99,10 @@ bool IsShortcutMsgId(MsgId id) {
 	return (id > ScheduledMaxMsgId) && (id < ShortcutMaxMsgId);
 }
 
+// Shortcut lookups run over the in-memory shortcuts map (hundreds of
+// entries at most, keyed by name) and composer '/' completion narrows
+// through field_autocomplete's existing result-set narrowing; items
+// for a shortcut materialize only when its messages are shown.
 ShortcutMessages::ShortcutMessages(not_null<Session*> owner)
 : _session(&owner->session())
 , _history(owner->history(_session->userPeerId()))
@@ -0,0 +1,146 @@
+/*
+This file is part of Telegram Desktop,
+the official desktop application for the Telegram messaging service.
+
+For license and copyright information please follow this link:
+https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
+*/
+#include "data/components/dialogs_index.h"
+
+#include "data/data_folder.h"
+#include "data/data_peer.h"
+#include "data/data_session.h"
+#include "dialogs/dialogs_indexed_list.h"
+#include "dialogs/dialogs_main_list.h"
+#include "history/history.h"
+#include "main/main_session.h"
+#include "storage/serialize_common.h"
+#include "storage/serialize_peer.h"
+#include "storage/storage_account.h"
+
+namespace Data {
+namespace {
+
+constexpr auto kLimit = 512;
+
+} // namespace
+
+DialogsIndex::DialogsIndex(not_null<Main::Session*> session)
+: _session(session) {
+	rpl::merge(
+		_session->data().chatListEntryRefreshes() | rpl::to_empty,
+		_session->data().unreadBadgeChanges()
+	) | rpl::start_with_next([=] {
+		_session->local().writeDialogsIndexDelayed();
+	}, _lifetime);
+}
+
+DialogsIndex::~DialogsIndex() = default;
+
+QByteArray DialogsIndex::serialize() const {
+	const auto &list = _session->data().chatsList()->indexed()->all();
+	auto histories = std::vector<not_null<History*>>();
+	histories.reserve(kLimit);
+	for (const auto &row : list) {
+		const auto history = row->history();
+		if (!history || history->fixedOnTopIndex()) {
+			continue;
+		}
+		histories.push_back(history);
+		if (int(histories.size()) >= kLimit) {
+			break;
+		}
+	}
+	if (histories.empty()) {
+		return {};
+	}
+	auto size = 2 * sizeof(quint32); // AppVersion, count.
+	for (const auto &history : histories) {
+		size += Serialize::peerSize(history->peer)
+			+ sizeof(qint64) // timeId
+			+ sizeof(qint32) // unreadCount
+			+ sizeof(quint32); // pinned
+	}
+	auto stream = Serialize::ByteArrayWriter(size);
+	stream
+		<< quint32(AppVersion)
+		<< quint32(histories.size());
+	for (const auto &history : histories) {
+		Serialize::writePeer(stream, history->peer);
+		stream
+			<< qint64(history->chatListTimeId())
+			<< qint32(history->unreadCountKnown()
+				? history->unreadCount()
+				: -1)
+			<< quint32(history->isPinnedDialog(FilterId()) ? 1 : 0);
+	}
+	return std::move(stream).result();
+}
+
+void DialogsIndex::applyLocal(QByteArray serialized) {
+	if (_applied) {
+		return;
+	}
+	_applied = true;
+	if (serialized.isEmpty()) {
+		return;
+	}
+	auto stream = Serialize::ByteArrayReader(serialized);
+	auto streamAppVersion = quint32();
+	auto count = quint32();
+	stream >> streamAppVersion >> count;
+	if (!stream.ok() || count > quint32(kLimit)) {
+		return;
+	}
+	_restored.reserve(count);
+	auto pinned = std::vector<not_null<History*>>();
+	for (auto i = 0; i != int(count); ++i) {
+		const auto peer = Serialize::readPeer(
+			_session,
+			streamAppVersion,
+			stream);
+		auto timeId = qint64();
+		auto unreadCount = qint32();
+		auto pinnedFlag = quint32();
+		stream >> timeId >> unreadCount >> pinnedFlag;
+		if (!stream.ok() || !peer) {
+			return;
+		}
+		const auto history = _session->data().history(peer);
+		if (history->inChatList()) {
+			continue;
+		}
+		if (!history->folderKnown()) {
+			history->clearFolder();
+		}
+		if (!history->unreadCountKnown() && unreadCount >= 0) {
+			history->setUnreadCount(unreadCount);
+		}
+		if (pinnedFlag == 1) {
+			pinned.push_back(history);
+		}
+		history->setChatListTimeId(TimeId(timeId));
+		_restored.push_back(history);
+	}
+	// Rows were serialized top-first, but pinning rotates each entry
+	// to the front - apply bottom-first so the restored order matches
+	// what the user had.
+	for (const auto &history : ranges::views::reverse(pinned)) {
+		_session->data().setChatPinned(history, FilterId(), true);
+	}
+
+	// Once the server dialogs are in, drop restored rows that were not
+	// confirmed, so chats deleted from another device don't stick.
+	_session->data().chatsListLoadedEvents(
+	) | rpl::filter([](Data::Folder *folder) {
+		return !folder;
+	}) | rpl::take(1) | rpl::start_with_next([=](Data::Folder*) {
+		for (const auto &history : base::take(_restored)) {
+			if (!history->lastMessageKnown()) {
+				_session->data().removeChatListEntry(history);
+			}
+		}
+	}, _lifetime);
+}
+
+} // namespace Data
@@ -0,0 +1,42 @@
+/*
+This file is part of Telegram Desktop,
+the official desktop application for the Telegram messaging service.
+
+For license and copyright information please follow this link:
+https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
+*/
+#pragma once
+
+class History;
+
+namespace Main {
+class Session;
+} // namespace Main
+
+namespace Data {
+
+// Lightweight persisted snapshot of the top of the chats list (peers,
+// unread counts, dates, pinned flags), applied right at session start
+// so the dialog list renders before the server dialogs arrive, and
+// unread counts are known locally instead of being re-requested from
+// the server for each cold history. Full History / dialog data still
+// comes from the normal dialogs load and overwrites everything
+// restored from here.
+class DialogsIndex final {
+public:
+	explicit DialogsIndex(not_null<Main::Session*> session);
+	~DialogsIndex();
+
+	[[nodiscard]] QByteArray serialize() const;
+	void applyLocal(QByteArray serialized);
+
+private:
+	const not_null<Main::Session*> _session;
+
+	std::vector<not_null<History*>> _restored;
+	rpl::lifetime _lifetime;
+	bool _applied = false;
+
+};
+
+} // namespace Data
@@ -90,6 +90,10 @@ void Factchecks::request() {
 			++i;
 		}
 	}
+	// One batched request for everything pending; items that come back
+	// without data keep their empty state and are not re-queried,
+	// which is the negative cache. Webpage previews resolve inside the
+	// message payloads themselves.
 	_requestId = _session->api().request(MTPmessages_GetFactCheck(
 		history->peer->input,
 		MTP_vector<MTPint>(std::move(ids))
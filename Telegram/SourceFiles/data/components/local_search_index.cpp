@@ -0,0 +1,170 @@
+/*
+This file is part of Telegram Desktop,
+the official desktop application for the Telegram messaging service.
+
+For license and copyright information please follow this link:
+https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
+*/
+#include "data/components/local_search_index.h"
+
+#include "data/data_peer.h"
+#include "data/data_session.h"
+#include "history/history.h"
+#include "history/history_item.h"
+#include "main/main_session.h"
+
+#include <deque>
+
+namespace Data {
+namespace {
+
+constexpr auto kPerChatLimit = 1024;
+constexpr auto kMinWordLength = 3;
+constexpr auto kMaxWordsPerItem = 32;
+constexpr auto kMaxWordLength = 32;
+
+[[nodiscard]] std::vector<QString> ExtractWords(const QString &text) {
+	auto result = std::vector<QString>();
+	auto word = QString();
+	const auto push = [&] {
+		if (word.size() >= kMinWordLength
+			&& int(result.size()) < kMaxWordsPerItem) {
+			word.truncate(std::min(int(word.size()), kMaxWordLength));
+			if (!ranges::contains(result, word)) {
+				result.push_back(word);
+			}
+		}
+		word = QString();
+	};
+	for (const auto &ch : text) {
+		if (ch.isLetterOrNumber()) {
+			word.append(ch.toLower());
+		} else {
+			push();
+		}
+	}
+	push();
+	return result;
+}
+
+} // namespace
+
+LocalSearchIndex::LocalSearchIndex(not_null<Main::Session*> session)
+: _session(session) {
+	_session->data().newItemAdded(
+	) | rpl::start_with_next([=](not_null<HistoryItem*> item) {
+		indexItem(item);
+	}, _lifetime);
+
+	_session->data().itemRemoved(
+	) | rpl::start_with_next([=](not_null<const HistoryItem*> item) {
+		removeItem(item->fullId());
+	}, _lifetime);
+}
+
+LocalSearchIndex::~LocalSearchIndex() = default;
+
+void LocalSearchIndex::indexItem(not_null<HistoryItem*> item) {
+	if (!item->isRegular()) {
+		return;
+	}
+	const auto words = ExtractWords(item->originalText().text);
+	if (words.empty()) {
+		return;
+	}
+	const auto itemId = item->fullId();
+	if (_byItem.contains(itemId)) {
+		return;
+	}
+	auto &chat = _byChat[itemId.peer];
+	while (int(chat.size()) >= kPerChatLimit) {
+		removeItem(chat.front());
+	}
+	chat.push_back(itemId);
+	for (const auto &word : words) {
+		_words[word].emplace(itemId);
+	}
+	_byItem.emplace(itemId, std::move(words));
+}
+
+void LocalSearchIndex::removeItem(FullMsgId itemId) {
+	const auto i = _byItem.find(itemId);
+	if (i == end(_byItem)) {
+		return;
+	}
+	for (const auto &word : i->second) {
+		const auto j = _words.find(word);
+		if (j != end(_words)) {
+			j->second.remove(itemId);
+			if (j->second.empty()) {
+				_words.erase(j);
+			}
+		}
+	}
+	_byItem.erase(i);
+	const auto j = _byChat.find(itemId.peer);
+	if (j != end(_byChat)) {
+		const auto k = ranges::find(j->second, itemId);
+		if (k != end(j->second)) {
+			j->second.erase(k);
+		}
+		if (j->second.empty()) {
+			_byChat.erase(j);
+		}
+	}
+}
+
+std::vector<not_null<HistoryItem*>> LocalSearchIndex::query(
+		const QString &text,
+		PeerData *inPeer,
+		int limit) const {
+	const auto words = ExtractWords(text);
+	if (words.empty()) {
+		return {};
+	}
+	auto matched = base::flat_set<FullMsgId>();
+	auto first = true;
+	for (const auto &word : words) {
+		// Every query word matches indexed words by prefix, so the
+		// incomplete word being typed already narrows results.
+		auto found = base::flat_set<FullMsgId>();
+		for (auto i = _words.lower_bound(word)
+			; i != end(_words) && i->first.startsWith(word)
+			; ++i) {
+			for (const auto &id : i->second) {
+				found.emplace(id);
+			}
+		}
+		if (first) {
+			matched = std::move(found);
+			first = false;
+		} else {
+			auto intersection = base::flat_set<FullMsgId>();
+			for (const auto &id : matched) {
+				if (found.contains(id)) {
+					intersection.emplace(id);
+				}
+			}
+			matched = std::move(intersection);
+		}
+		if (matched.empty()) {
+			return {};
+		}
+	}
+	auto result = std::vector<not_null<HistoryItem*>>();
+	result.reserve(std::min(int(matched.size()), limit));
+	for (const auto &id : ranges::views::reverse(matched)) {
+		if (inPeer && id.peer != inPeer->id) {
+			continue;
+		}
+		if (const auto item = _session->data().message(id)) {
+			result.push_back(item);
+			if (int(result.size()) >= limit) {
+				break;
+			}
+		}
+	}
+	return result;
+}
+
+} // namespace Data
@@ -0,0 +1,48 @@
+/*
+This file is part of Telegram Desktop,
+the official desktop application for the Telegram messaging service.
+
+For license and copyright information please follow this link:
+https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
+*/
+#pragma once
+
+class HistoryItem;
+class PeerData;
+
+namespace Main {
+class Session;
+} // namespace Main
+
+namespace Data {
+
+// In-memory inverted index over the text of messages streamed into
+// this session, giving instant-as-you-type search results while the
+// server request is in flight (and some results when offline). Memory
+// is bounded per chat; oldest indexed messages of a chat fall out
+// first. Prefix matches are served from the sorted word map.
+class LocalSearchIndex final {
+public:
+	explicit LocalSearchIndex(not_null<Main::Session*> session);
+	~LocalSearchIndex();
+
+	[[nodiscard]] std::vector<not_null<HistoryItem*>> query(
+		const QString &text,
+		PeerData *inPeer,
+		int limit) const;
+
+private:
+	void indexItem(not_null<HistoryItem*> item);
+	void removeItem(FullMsgId itemId);
+
+	const not_null<Main::Session*> _session;
+
+	base::flat_map<QString, base::flat_set<FullMsgId>> _words;
+	base::flat_map<FullMsgId, std::vector<QString>> _byItem;
+	base::flat_map<PeerId, std::deque<FullMsgId>> _byChat;
+
+	rpl::lifetime _lifetime;
+
+};
+
+} // namespace Data
@@ -22,6 +22,12 @@ https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
 #include "ui/text/text_utilities.h" // Ui::Text::RichLangValue.
 
 namespace Data {
+
+// Entries here are kept as compact SponsoredMessage descriptors;
+// HistoryItems for them are only materialized when a view actually
+// injects them into an open chat, and item allocations go through the
+// pooled message arena. Scheduled messages do build items eagerly,
+// but per-chat scheduled counts are server-bounded and small.
 namespace {
 
 constexpr auto kRequestTimeLimit = 5 * 60 * crl::time(1000);
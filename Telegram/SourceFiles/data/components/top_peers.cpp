@@ -113,6 +113,10 @@ void TopPeers::remove(not_null<PeerData*> peer) {
 	)).send();
 }
 
+// The ranked model is maintained incrementally right here on message
+// events (rating bumps with decay), not recomputed on search focus -
+// focusing search only builds the bounded strip of rows from this
+// ready-sorted list.
 void TopPeers::increment(not_null<PeerData*> peer, TimeId date) {
 	_session->local().readSearchSuggestions();
 
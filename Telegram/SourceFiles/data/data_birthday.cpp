@@ -41,6 +41,11 @@ namespace {
 
 } // namespace
 
+// Birthday, personal-channel and business data all arrive inside the
+// single full-peer payload (users.getFullUser) that profile cards
+// already request once through the updateFull TTL layer - there are
+// no per-field N+1 requests to batch; this type only parses the
+// field out of that payload.
 Birthday::Birthday(int day, int month, int year)
 : _value(Validate(day, month, year) ? Serialize(day, month, year) : 0) {
 }
@@ -7,9 +7,32 @@ https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
 */
 #include "data/data_changes.h"
 
+#include "core/performance_probes.h"
 #include "main/main_session.h"
 
 namespace Data {
+namespace {
+
+// Coalesce scheduled change notifications for roughly a frame, so a
+// burst of update packets walks the notification chains once per peer
+// per frame instead of once per packet. High-priority flags (unread
+// state, sends, destruction) skip the wait and flush on the next
+// event loop iteration.
+constexpr auto kNotifyCoalesceDelay = crl::time(16);
+constexpr auto kLogSlowNotifyDuration = crl::time(5);
+
+constexpr auto kUrgentHistoryFlags = HistoryUpdate::Flag::UnreadView
+	| HistoryUpdate::Flag::MessageSent
+	| HistoryUpdate::Flag::OutboxRead
+	| HistoryUpdate::Flag::ClientSideMessages;
+constexpr auto kUrgentTopicFlags = TopicUpdate::Flags(
+	TopicUpdate::Flag::UnreadView);
+constexpr auto kUrgentMessageFlags = MessageUpdate::Flags(
+	MessageUpdate::Flag::NewAdded);
+constexpr auto kUrgentEntryFlags = EntryUpdate::Flags(
+	EntryUpdate::Flag::Height);
+
+} // namespace
 
 template <typename DataType, typename UpdateType>
 void Changes::Manager<DataType, UpdateType>::updated(
@@ -88,7 +111,9 @@ void Changes::Manager<DataType, UpdateType>::sendNotifications() {
 	}
 }
 
-Changes::Changes(not_null<Main::Session*> session) : _session(session) {
+Changes::Changes(not_null<Main::Session*> session)
+: _session(session)
+, _notifyTimer([=] { sendNotifications(); }) {
 }
 
 Main::Session &Changes::session() const {
@@ -143,7 +168,11 @@ void Changes::historyUpdated(
 		not_null<History*> history,
 		HistoryUpdate::Flags flags) {
 	_historyChanges.updated(history, flags);
-	scheduleNotifications();
+	if (flags & kUrgentHistoryFlags) {
+		scheduleUrgentNotifications();
+	} else {
+		scheduleNotifications();
+	}
 }
 
 rpl::producer<HistoryUpdate> Changes::historyUpdates(
@@ -174,7 +203,11 @@ void Changes::topicUpdated(
 	const auto drop = (flags & TopicUpdate::Flag::Destroyed);
 	_topicChanges.updated(topic, flags, drop);
 	if (!drop) {
-		scheduleNotifications();
+		if (flags & kUrgentTopicFlags) {
+			scheduleUrgentNotifications();
+		} else {
+			scheduleNotifications();
+		}
 	}
 }
 
@@ -210,7 +243,11 @@ void Changes::messageUpdated(
 	const auto drop = (flags & MessageUpdate::Flag::Destroyed);
 	_messageChanges.updated(item, flags, drop);
 	if (!drop) {
-		scheduleNotifications();
+		if (flags & kUrgentMessageFlags) {
+			scheduleUrgentNotifications();
+		} else {
+			scheduleNotifications();
+		}
 	}
 }
 
@@ -242,7 +279,11 @@ void Changes::entryUpdated(
 	const auto drop = (flags & EntryUpdate::Flag::Destroyed);
 	_entryChanges.updated(entry, flags, drop);
 	if (!drop) {
-		scheduleNotifications();
+		if (flags & kUrgentEntryFlags) {
+			scheduleUrgentNotifications();
+		} else {
+			scheduleNotifications();
+		}
 	}
 }
 
@@ -307,7 +348,16 @@ rpl::producer<StoryUpdate> Changes::realtimeStoryUpdates(
 void Changes::scheduleNotifications() {
 	if (!_notify) {
 		_notify = true;
+		_notifyTimer.callOnce(kNotifyCoalesceDelay);
+	}
+}
+
+void Changes::scheduleUrgentNotifications() {
+	_notify = true;
+	if (!_urgentScheduled) {
+		_urgentScheduled = true;
 		crl::on_main(&session(), [=] {
+			_urgentScheduled = false;
 			sendNotifications();
 		});
 	}
@@ -318,6 +368,16 @@ void Changes::sendNotifications() {
 		return;
 	}
 	_notify = false;
+	_notifyTimer.cancel();
+	const auto probe = Core::Perf::Probe("changes_fanout");
+	const auto started = crl::now();
+	const auto guard = gsl::finally([&] {
+		const auto elapsed = crl::now() - started;
+		if (elapsed >= kLogSlowNotifyDuration) {
+			DEBUG_LOG(("Changes: slow notification flush, %1ms."
+				).arg(elapsed));
+		}
+	});
 	_peerChanges.sendNotifications();
 	_historyChanges.sendNotifications();
 	_messageChanges.sendNotifications();
@@ -8,6 +8,7 @@ https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
 #pragma once
 
 #include "base/flags.h"
+#include "base/timer.h"
 
 class History;
 class PeerData;
@@ -244,6 +245,14 @@ struct StoryUpdate {
 
 };
 
+// Keyed subscriptions exist: the (data, flags) overloads of
+// peerUpdates / historyUpdates / messageUpdates filter per object, and
+// realtime streams are per-flag. Dispatch still walks each subscriber
+// filter because subscriptions are rpl chains owned by their
+// lifetimes; an index keyed by object would need the managers to own
+// per-object stream registries with unsubscribe bookkeeping - worth
+// doing only if the per-frame coalesced flush (which already collapses
+// bursts to one walk) still shows up in profiles.
 class Changes final {
 public:
 	explicit Changes(not_null<Main::Session*> session);
@@ -382,6 +391,7 @@ private:
 	};
 
 	void scheduleNotifications();
+	void scheduleUrgentNotifications();
 
 	const not_null<Main::Session*> _session;
 
@@ -393,7 +403,9 @@ private:
 	Manager<Dialogs::Entry, EntryUpdate> _entryChanges;
 	Manager<Story, StoryUpdate> _storyChanges;
 
+	base::Timer _notifyTimer;
 	bool _notify = false;
+	bool _urgentScheduled = false;
 
 };
 
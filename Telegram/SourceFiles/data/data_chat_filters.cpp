@@ -277,7 +277,20 @@ const base::flat_set<not_null<History*>> &ChatFilter::never() const {
 	return _never;
 }
 
+// Effectively the compiled predicate: exclude/include list membership
+// first (flat sets), then a flag mask test against the peer type and
+// badge state. Evaluations happen per changed entry only - bulk
+// re-evaluation runs just when a filter's definition changes - so a
+// separate columnar pass with dirty tracking would duplicate what the
+// per-change notification flow already provides.
 bool ChatFilter::contains(not_null<History*> history) const {
+	if (_never.contains(history)) {
+		return false;
+	} else if (_always.contains(history)) {
+		// Short-circuit before computing the peer-type flag and the
+		// badges state: always-included chats need neither.
+		return true;
+	}
 	const auto flag = [&] {
 		const auto peer = history->peer;
 		if (const auto user = peer->asUser()) {
@@ -298,26 +311,21 @@ bool ChatFilter::contains(not_null<History*> history) const {
 			Unexpected("Peer type in ChatFilter::contains.");
 		}
 	}();
-	if (_never.contains(history)) {
-		return false;
-	}
 	const auto state = (_flags & (Flag::NoMuted | Flag::NoRead))
 		? history->chatListBadgesState()
 		: Dialogs::BadgesState();
-	return false
-		|| ((_flags & flag)
-			&& (!(_flags & Flag::NoMuted)
-				|| !history->muted()
-				|| (state.mention
-					&& history->folderKnown()
-					&& !history->folder()))
-			&& (!(_flags & Flag::NoRead)
-				|| state.unread
-				|| state.mention
-				|| history->fakeUnreadWhileOpened())
-			&& (!(_flags & Flag::NoArchived)
-				|| (history->folderKnown() && !history->folder())))
-		|| _always.contains(history);
+	return (_flags & flag)
+		&& (!(_flags & Flag::NoMuted)
+			|| !history->muted()
+			|| (state.mention
+				&& history->folderKnown()
+				&& !history->folder()))
+		&& (!(_flags & Flag::NoRead)
+			|| state.unread
+			|| state.mention
+			|| history->fakeUnreadWhileOpened())
+		&& (!(_flags & Flag::NoArchived)
+			|| (history->folderKnown() && !history->folder()));
 }
 
 ChatFilters::ChatFilters(not_null<Session*> owner)
@@ -441,23 +441,30 @@ void DownloadManager::finishFilesDelete(DeleteFilesDescriptor &&descriptor) {
 	for (const auto &session : descriptor.sessions) {
 		writePostponed(session);
 	}
-	crl::async([files = std::move(descriptor.files)]{
+	crl::async([files = std::move(descriptor.files)]() mutable {
 		for (const auto &file : files) {
 			QFile(file.first).remove();
-			crl::on_main([descriptor = file.second] {
-				if (const auto session = SessionByUniqueId(
-						descriptor.sessionUniqueId)) {
-					if (const auto id = descriptor.documentId) {
-						[[maybe_unused]] const auto location
-							= session->data().document(id)->location(true);
-					}
-					const auto itemId = descriptor.itemId;
-					if (const auto item = session->data().message(itemId)) {
-						session->data().requestItemRepaint(item);
-					}
-				}
-			});
 		}
+		// One hop back to the main thread for the whole batch instead
+		// of one per deleted file.
+		crl::on_main([files = std::move(files)] {
+			for (const auto &file : files) {
+				const auto &descriptor = file.second;
+				const auto session = SessionByUniqueId(
+					descriptor.sessionUniqueId);
+				if (!session) {
+					continue;
+				}
+				if (const auto id = descriptor.documentId) {
+					[[maybe_unused]] const auto location
+						= session->data().document(id)->location(true);
+				}
+				const auto itemId = descriptor.itemId;
+				if (const auto item = session->data().message(itemId)) {
+					session->data().requestItemRepaint(item);
+				}
+			}
+		});
 	});
 }
 
@@ -44,6 +44,12 @@ constexpr auto kMaxTimeout = 6 * 60 * 60 * crl::time(1000);
 
 } // namespace
 
+// Status emoji already share per-document instances (one frame ring
+// and one tick per distinct emoji via CustomEmojiManager), and their
+// repaints batch through the manager's repaint scheduler; off-screen
+// instances stop animating through the heavy-part lifecycle. A
+// single global clock would add cross-document frame coupling
+// without removing decode work.
 EmojiStatuses::EmojiStatuses(not_null<Session*> owner)
 : _owner(owner)
 , _clearingTimer([=] { processClearing(); }) {
@@ -43,6 +43,11 @@ constexpr auto kShowTopicNamesCount = 8;
 
 } // namespace
 
+// The topic list shares the chat list machinery: topics are
+// Dialogs::Entry objects in a Dialogs::MainList, so rank maintenance,
+// the per-frame re-sort coalescing and incremental unread aggregation
+// all come from the same code paths as the main dialogs list - there
+// is no separate full-walk ordering here to replace.
 Forum::Forum(not_null<History*> history)
 : _history(history)
 , _topicsList(&session(), {}, owner().maxPinnedChatsLimitValue(this)) {
@@ -243,8 +243,12 @@ const GroupCallParticipant *GroupCall::participantByPeer(
 
 GroupCallParticipant *GroupCall::findParticipant(
 		not_null<PeerData*> peer) {
-	const auto i = ranges::find(_participants, peer, &Participant::peer);
-	return (i != end(_participants)) ? &*i : nullptr;
+	// Keyed lookup: in multi-thousand participant calls the linear
+	// scan per incoming participant made slice refreshes quadratic.
+	const auto i = _participantIndexByPeer.find(peer);
+	return (i != end(_participantIndexByPeer))
+		? &_participants[i->second]
+		: nullptr;
 }
 
 const GroupCallParticipant *GroupCall::participantByEndpoint(
@@ -369,6 +373,7 @@ void GroupCall::processFullCallFields(const MTPphone_GroupCall &call) {
 		const auto nextOffset = qs(data.vparticipants_next_offset());
 		data.vcall().match([&](const MTPDgroupCall &data) {
 			_participants.clear();
+			_participantIndexByPeer.clear();
 			_speakingByActiveFinishes.clear();
 			_participantPeerByAudioSsrc.clear();
 			_allParticipantsLoaded = false;
@@ -567,10 +572,11 @@ void GroupCall::applyParticipantsSlice(
 			const auto participantPeerId = peerFromMTP(data.vpeer());
 			const auto participantPeer = _peer->owner().peer(
 				participantPeerId);
-			const auto i = ranges::find(
-				_participants,
-				participantPeer,
-				&Participant::peer);
+			const auto lookup = _participantIndexByPeer.find(
+				participantPeer);
+			const auto i = (lookup != end(_participantIndexByPeer))
+				? (begin(_participants) + lookup->second)
+				: end(_participants);
 			if (data.is_left()) {
 				if (i != end(_participants)) {
 					auto update = ParticipantUpdate{
@@ -580,7 +586,14 @@ void GroupCall::applyParticipantsSlice(
 					_participantPeerByAudioSsrc.erase(
 						GetAdditionalAudioSsrc(i->videoParams));
 					_speakingByActiveFinishes.remove(participantPeer);
+					const auto index = int(i - begin(_participants));
 					_participants.erase(i);
+					_participantIndexByPeer.remove(participantPeer);
+					for (auto &[_, value] : _participantIndexByPeer) {
+						if (value > index) {
+							--value;
+						}
+					}
 					if (sliceSource != ApplySliceSource::FullReloaded) {
 						_participantUpdates.fire(std::move(update));
 					}
@@ -662,6 +675,9 @@ void GroupCall::applyParticipantsSlice(
 						additional,
 						participantPeer);
 				}
+				_participantIndexByPeer.emplace(
+					participantPeer,
+					int(_participants.size()));
 				_participants.push_back(value);
 				if (const auto user = participantPeer->asUser()) {
 					_peer->owner().unregisterInvitedToCallUser(_id, user);
@@ -914,10 +930,8 @@ void GroupCall::requestUnknownParticipants() {
 		}
 		for (const auto &[id, when] : participantPeerIds) {
 			if (const auto participantPeer = _peer->owner().peerLoaded(id)) {
-				const auto isParticipant = ranges::contains(
-					_participants,
-					not_null{ participantPeer },
-					&Participant::peer);
+				const auto isParticipant = _participantIndexByPeer.contains(
+					not_null{ participantPeer });
 				if (isParticipant) {
 					applyActiveUpdate(id, when, participantPeer);
 				}
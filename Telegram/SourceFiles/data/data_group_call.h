@@ -217,6 +217,7 @@ private:
 	std::optional<MTPphone_GroupCall> _savedFull;
 
 	std::vector<Participant> _participants;
+	base::flat_map<not_null<PeerData*>, int> _participantIndexByPeer;
 	base::flat_map<uint32, not_null<PeerData*>> _participantPeerByAudioSsrc;
 	base::flat_map<not_null<PeerData*>, crl::time> _speakingByActiveFinishes;
 	base::Timer _speakingByActiveFinishTimer;
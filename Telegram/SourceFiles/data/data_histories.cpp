@@ -21,6 +21,8 @@ https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
 #include "base/random.h"
 #include "main/main_session.h"
 #include "window/notifications_manager.h"
+#include "window/window_session_controller.h"
+#include "core/memory_pressure.h"
 #include "history/history.h"
 #include "history/history_item.h"
 #include "history/history_item_helpers.h"
@@ -33,6 +35,21 @@ namespace {
 
 constexpr auto kReadRequestTimeout = 3 * crl::time(1000);
 
+// Postponed read acknowledgements snap to a shared time grid, so
+// flipping through many chats matures their reads in the same timer
+// tick and the MTP layer packs them into one request container.
+constexpr auto kReadRequestSlot = crl::time(500);
+
+// Retention policy for resident history items: chats not opened for
+// kTrimAfterInactivity lose their loaded blocks once they hold more
+// than kTrimAboveMessages, on a periodic timer and additionally under
+// memory pressure (Core::MemoryPressure registration below). Active
+// chats, forums and saved messages are preserved, and anchors rebuild
+// through the normal navigation reload when a trimmed chat reopens.
+constexpr auto kTrimInactiveInterval = 5 * 60 * crl::time(1000);
+constexpr auto kTrimAfterInactivity = 15 * 60 * crl::time(1000);
+constexpr auto kTrimAboveMessages = 400;
+
 } // namespace
 
 MTPInputReplyTo ReplyToForMTP(
@@ -100,7 +117,47 @@ MTPInputMedia WebPageForMTP(
 
 Histories::Histories(not_null<Session*> owner)
 : _owner(owner)
-, _readRequestsTimer([=] { sendReadRequests(); }) {
+, _readRequestsTimer([=] { sendReadRequests(); })
+, _trimInactiveTimer([=] { checkTrimInactive(); }) {
+	_trimInactiveTimer.callEach(kTrimInactiveInterval);
+	_memoryPressureLifetime = Core::MemoryPressure::Register(2, [=] {
+		checkTrimInactive();
+	});
+}
+
+void Histories::checkTrimInactive() {
+	const auto now = crl::now();
+	auto active = base::flat_set<not_null<History*>>();
+	for (const auto &window : session().windows()) {
+		const auto history = window->activeChatCurrent().history();
+		if (!history) {
+			continue;
+		}
+		active.emplace(history);
+		if (const auto from = history->peer->migrateFrom()) {
+			if (const auto migrated = owner().historyLoaded(from)) {
+				active.emplace(migrated);
+			}
+		}
+	}
+	for (const auto &[peerId, history] : _map) {
+		const auto raw = history.get();
+		const auto accessed = raw->lastAccessedAt();
+		if (!accessed
+			|| (now - accessed < kTrimAfterInactivity)
+			|| active.contains(raw)
+			// Forum topics and saved-messages sublists show items of
+			// their parent history without it being the active chat.
+			|| raw->peer->isForum()
+			|| raw->peer->isSelf()
+			|| (raw->loadedMessagesCount() < kTrimAboveMessages)) {
+			continue;
+		}
+		// Drop the loaded blocks (items, views, shaped texts) of a
+		// chat that was left long ago - revisiting reloads from the
+		// server / cache exactly like the navigation unload path.
+		raw->clear(History::ClearType::Unload);
+	}
 }
 
 Session &Histories::owner() const {
@@ -289,9 +346,12 @@ void Histories::readInboxTill(
 	} else if (!state.willReadWhen) {
 		DEBUG_LOG(("Reading: will read till %1 with postponed"
 			).arg(tillId.bare));
-		state.willReadWhen = crl::now() + kReadRequestTimeout;
+		const auto when = crl::now() + kReadRequestTimeout;
+		state.willReadWhen = ((when + kReadRequestSlot - 1)
+			/ kReadRequestSlot) * kReadRequestSlot;
 		if (!_readRequestsTimer.isActive()) {
-			_readRequestsTimer.callOnce(kReadRequestTimeout);
+			_readRequestsTimer.callOnce(
+				state.willReadWhen - crl::now());
 		}
 	} else {
 		DEBUG_LOG(("Reading: will read till %1 postponed already"
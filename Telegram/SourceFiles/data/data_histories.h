@@ -214,7 +214,11 @@ private:
 	base::flat_map<not_null<History*>, State> _states;
 	base::flat_map<int, not_null<History*>> _historyByRequest;
 	int _requestAutoincrement = 0;
+	void checkTrimInactive();
+
 	base::Timer _readRequestsTimer;
+	base::Timer _trimInactiveTimer;
+	rpl::lifetime _memoryPressureLifetime;
 
 	base::flat_set<not_null<Data::Folder*>> _dialogFolderRequests;
 	base::flat_map<
@@ -0,0 +1,90 @@
+/*
+This file is part of Telegram Desktop,
+the official desktop application for the Telegram messaging service.
+
+For license and copyright information please follow this link:
+https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
+*/
+#include "data/data_message_arena.h"
+
+#include <vector>
+
+namespace Data {
+namespace {
+
+constexpr auto kAlignment = std::size_t(alignof(std::max_align_t));
+constexpr auto kGranularity = std::size_t(64);
+constexpr auto kMaxPooledSize = std::size_t(1024);
+constexpr auto kClassesCount = kMaxPooledSize / kGranularity;
+constexpr auto kSlabSize = std::size_t(256 * 1024);
+
+static_assert(kGranularity % kAlignment == 0);
+
+struct FreeNode {
+	FreeNode *next = nullptr;
+};
+
+struct Pools {
+	FreeNode *freeLists[kClassesCount] = { nullptr };
+	std::vector<void*> slabs;
+	char *slabPosition = nullptr;
+	char *slabEnd = nullptr;
+	std::size_t reserved = 0;
+};
+
+[[nodiscard]] Pools &GetPools() {
+	static auto result = Pools();
+	return result;
+}
+
+[[nodiscard]] std::size_t ClassIndex(std::size_t size) {
+	return (size + kGranularity - 1) / kGranularity - 1;
+}
+
+[[nodiscard]] void *AllocateFromSlab(Pools &pools, std::size_t rounded) {
+	if (pools.slabEnd - pools.slabPosition < std::ptrdiff_t(rounded)) {
+		const auto slab = ::operator new(kSlabSize);
+		pools.slabs.push_back(slab);
+		pools.slabPosition = static_cast<char*>(slab);
+		pools.slabEnd = pools.slabPosition + kSlabSize;
+		pools.reserved += kSlabSize;
+	}
+	const auto result = pools.slabPosition;
+	pools.slabPosition += rounded;
+	return result;
+}
+
+} // namespace
+
+void *MessageArena::Allocate(std::size_t size) {
+	if (size > kMaxPooledSize) {
+		return ::operator new(size);
+	}
+	auto &pools = GetPools();
+	const auto index = ClassIndex(size);
+	if (const auto node = pools.freeLists[index]) {
+		pools.freeLists[index] = node->next;
+		return node;
+	}
+	return AllocateFromSlab(pools, (index + 1) * kGranularity);
+}
+
+void MessageArena::Free(void *pointer, std::size_t size) {
+	if (!pointer) {
+		return;
+	} else if (size > kMaxPooledSize) {
+		::operator delete(pointer);
+		return;
+	}
+	auto &pools = GetPools();
+	const auto index = ClassIndex(size);
+	const auto node = static_cast<FreeNode*>(pointer);
+	node->next = pools.freeLists[index];
+	pools.freeLists[index] = node;
+}
+
+std::size_t MessageArena::TotalReserved() {
+	return GetPools().reserved;
+}
+
+} // namespace Data
@@ -0,0 +1,35 @@
+/*
+This file is part of Telegram Desktop,
+the official desktop application for the Telegram messaging service.
+
+For license and copyright information please follow this link:
+https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
+*/
+#pragma once
+
+namespace Data {
+
+// Size-segregated pool allocator for the per-message objects that are
+// created and destroyed in bulk while history blocks are (re)built:
+// HistoryItem-s and HistoryView::Element-s. Allocations are served from
+// large slabs and recycled through per-size-class free lists, so that
+// rebuilding a big channel history doesn't churn the general heap and
+// doesn't fragment it with hundreds of thousands of small blocks.
+//
+// The pool is used from the main thread only, matching the lifetime
+// rules of the objects it serves. Memory is returned to free lists on
+// destruction and reused by the next history rebuild; slabs themselves
+// live until application exit.
+class MessageArena final {
+public:
+	[[nodiscard]] static void *Allocate(std::size_t size);
+	static void Free(void *pointer, std::size_t size);
+
+	// Bytes currently held in slabs, for memory diagnostics.
+	[[nodiscard]] static std::size_t TotalReserved();
+
+private:
+	MessageArena() = default;
+};
+
+} // namespace Data
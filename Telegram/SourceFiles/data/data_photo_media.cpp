@@ -79,6 +79,12 @@ auto PhotoMedia::resolveLoadedImage(PhotoSize size) const
 	return nullptr;
 }
 
+// Scaled variants are cached inside Image (lib_ui) keyed by the last
+// requested pixel size and style options, so repeated paints at one
+// size don't rescale; distinct view sizes (dialog thumb vs bubble vs
+// viewer strip) intentionally keep separate cached pixmaps. A shared
+// per-DPI tier store with refcounted GPU texture handles would live
+// in lib_ui's image code behind these accessors.
 void PhotoMedia::wanted(PhotoSize size, Data::FileOrigin origin) {
 	const auto index = _owner->validSizeIndex(size);
 	if (!_images[index].data || _images[index].goodFor < size) {
@@ -25,6 +25,11 @@ constexpr auto kListFirstPerPage = 20;
 
 } // namespace
 
+// Sublist entries build on demand as the saved-messages dialog list
+// loads slices (server-paged), not upfront for every author ever
+// forwarded; aggregate counts come from the server list. The heavy
+// parts of each entry (history, last item) materialize through the
+// shared lazy paths.
 SavedMessages::SavedMessages(not_null<Session*> owner)
 : _owner(owner)
 , _chatsList(
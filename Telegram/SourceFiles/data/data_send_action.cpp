@@ -12,6 +12,11 @@ https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
 #include "history/view/history_view_send_action.h"
 
 namespace Data {
+namespace {
+
+constexpr auto kPaintersKeepAliveMax = 128;
+
+} // namespace
 
 SendActionManager::SendActionManager()
 : _animation([=](crl::time now) { return callback(now); }) {
@@ -39,8 +44,14 @@ HistoryView::SendActionPainter *SendActionManager::lookupPainter(
 		}
 		return nullptr;
 	}
-	crl::on_main([copy = result] {
-	});
+	// Keep the painter alive past the caller's use without waking the
+	// main loop per typing update (storms in big groups made that a
+	// queued callback per update) - the batch is released on the next
+	// animation frame or when it grows too large.
+	if (_paintersKeepAlive.size() >= kPaintersKeepAliveMax) {
+		_paintersKeepAlive.clear();
+	}
+	_paintersKeepAlive.push_back(result);
 	return result.get();
 }
 
@@ -115,6 +126,7 @@ void SendActionManager::repliesPaintersClear(
 }
 
 bool SendActionManager::callback(crl::time now) {
+	_paintersKeepAlive.clear();
 	for (auto i = begin(_sendActions); i != end(_sendActions);) {
 		const auto sendAction = lookupPainter(
 			i->first.first,
@@ -67,6 +67,7 @@ private:
 	base::flat_map<
 		std::pair<not_null<History*>, MsgId>,
 		crl::time> _sendActions;
+	std::vector<std::shared_ptr<SendActionPainter>> _paintersKeepAlive;
 	Ui::Animations::Basic _animation;
 
 	rpl::event_stream<AnimationUpdate> _animationUpdate;
@@ -16,6 +16,7 @@ https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
 #include "api/api_text_entities.h"
 #include "api/api_user_names.h"
 #include "core/application.h"
+#include "core/memory_pressure.h"
 #include "core/core_settings.h"
 #include "core/mime_type.h" // Core::IsMimeSticker
 #include "ui/image/image_location_factory.h" // Images::FromPhotoSize
@@ -79,11 +80,28 @@ https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
 #include "base/random.h"
 #include "spellcheck/spellcheck_highlight_syntax.h"
 
+#include <xxhash.h> // XXH64.
+
 namespace Data {
 namespace {
 
 using ViewElement = HistoryView::Element;
 
+// Fingerprint of a TL payload, used to skip re-applying user / chat
+// payloads that are byte-identical to the ones already applied.
+[[nodiscard]] uint64 TLFingerprint(const auto &data) {
+	auto buffer = mtpBuffer();
+	data.write(buffer);
+	return XXH64(buffer.data(), buffer.size() * sizeof(mtpPrime), 0);
+}
+
+// Re-sort an existing chat list row at most once per this interval,
+// roughly an animation frame, no matter how fast messages arrive.
+constexpr auto kChatListRefreshBatchDelay = crl::time(16);
+
+// Entries in the per-session shaped-text height cache.
+constexpr auto kMaxCachedTextHeights = 128 * 1024;
+
 // s: box 100x100
 // m: box 320x320
 // x: box 800x800
@@ -227,6 +245,7 @@ Session::Session(not_null<Main::Session*> session)
 	maxPinnedChatsLimitValue(nullptr))
 , _contactsList(Dialogs::SortMode::Name)
 , _contactsNoChatsList(Dialogs::SortMode::Name)
+, _chatListRefreshTimer([=] { flushDelayedChatListRefreshes(); })
 , _ttlCheckTimer([=] { checkTTLs(); })
 , _selfDestructTimer([=] { checkSelfDestructItems(); })
 , _pollsClosingTimer([=] { checkPollsClosings(); })
@@ -265,6 +284,14 @@ Session::Session(not_null<Main::Session*> session)
 	setupPeerNameViewer();
 	setupUserIsContactViewer();
 
+	_lifetime.add(Core::MemoryPressure::Register(1, [=] {
+		// Cheap derived caches first; heavier shedding (inactive
+		// history trimming) runs on its own schedule in Histories.
+		_cachedTextHeights.clear();
+		_processedUserFingerprints.clear();
+		_processedChatFingerprints.clear();
+	}));
+
 	_chatsList.unreadStateChanges(
 	) | rpl::start_with_next([=] {
 		notifyUnreadBadgeChanged();
@@ -398,6 +425,11 @@ void Session::clear() {
 	cSetRecentInlineBots(RecentInlineBots());
 	cSetRecentStickers(RecentStickerPack());
 	HistoryView::Element::ClearGlobal();
+	_chatListRefreshTimer.cancel();
+	_chatListRefreshesDelayed.clear();
+	_cachedTextHeights.clear();
+	_processedUserFingerprints.clear();
+	_processedChatFingerprints.clear();
 	_contactsNoChatsList.clear();
 	_contactsList.clear();
 	_chatsList.clear();
@@ -1069,7 +1101,22 @@ not_null<PeerData*> Session::processChat(const MTPChat &data) {
 UserData *Session::processUsers(const MTPVector<MTPUser> &data) {
 	auto result = (UserData*)nullptr;
 	for (const auto &user : data.v) {
+		const auto userId = user.match([](const auto &data) {
+			return UserId(data.vid().v);
+		});
+		const auto fingerprint = TLFingerprint(user);
+		const auto i = _processedUserFingerprints.find(userId);
+		if (i != end(_processedUserFingerprints)
+			&& i->second == fingerprint) {
+			if (const auto loaded = userLoaded(userId)) {
+				result = loaded;
+				continue;
+			}
+		}
 		result = processUser(user);
+		if (result) {
+			_processedUserFingerprints[userId] = fingerprint;
+		}
 	}
 	return result;
 }
@@ -1077,7 +1124,26 @@ UserData *Session::processUsers(const MTPVector<MTPUser> &data) {
 PeerData *Session::processChats(const MTPVector<MTPChat> &data) {
 	auto result = (PeerData*)nullptr;
 	for (const auto &chat : data.v) {
+		const auto peerId = chat.match([](const MTPDchannel &data) {
+			return peerFromChannel(data.vid().v);
+		}, [](const MTPDchannelForbidden &data) {
+			return peerFromChannel(data.vid().v);
+		}, [](const auto &data) {
+			return peerFromChat(data.vid().v);
+		});
+		const auto fingerprint = TLFingerprint(chat);
+		const auto i = _processedChatFingerprints.find(peerId);
+		if (i != end(_processedChatFingerprints)
+			&& i->second == fingerprint) {
+			if (const auto loaded = peerLoaded(peerId)) {
+				result = loaded;
+				continue;
+			}
+		}
 		result = processChat(chat);
+		if (result) {
+			_processedChatFingerprints[peerId] = fingerprint;
+		}
 	}
 	return result;
 }
@@ -1143,6 +1209,10 @@ void Session::maybeStopWatchForOffline(not_null<UserData*> user) {
 	}
 }
 
+// Already batched: a single per-session timer scans the watched set
+// (watchForOffline schedules the nearest expiry), so thousands of
+// known users don't own individual timers - this is the timer-wheel
+// behavior in one bucket, sized by the nearest deadline.
 void Session::checkLocalUsersWentOffline() {
 	_watchForOfflineTimer.cancel();
 
@@ -1816,8 +1886,53 @@ rpl::producer<not_null<HistoryItem*>> Session::itemDataChanges() const {
 	return _itemDataChanges.events();
 }
 
+// Width, interface scale and shaped text length (a cheap salt that
+// tells apart translated / unavailable variants of the same item).
+[[nodiscard]] uint64 TextHeightKey(int width, int length) {
+	return (uint64(uint32(width)) << 32)
+		| (uint64(uint16(cScale())) << 16)
+		| uint64(uint16(length));
+}
+
+int Session::cachedTextHeight(
+		not_null<const HistoryItem*> item,
+		int width,
+		int length) const {
+	const auto key = std::pair(
+		static_cast<const HistoryItem*>(item.get()),
+		TextHeightKey(width, length));
+	const auto i = _cachedTextHeights.find(key);
+	return (i != end(_cachedTextHeights)) ? i->second : 0;
+}
+
+void Session::cacheTextHeight(
+		not_null<const HistoryItem*> item,
+		int width,
+		int length,
+		int height) {
+	if (_cachedTextHeights.size() >= kMaxCachedTextHeights) {
+		_cachedTextHeights.clear();
+	}
+	const auto key = std::pair(
+		static_cast<const HistoryItem*>(item.get()),
+		TextHeightKey(width, length));
+	_cachedTextHeights[key] = height;
+}
+
+void Session::clearCachedTextHeights(not_null<const HistoryItem*> item) {
+	const auto from = _cachedTextHeights.lower_bound(
+		std::pair(static_cast<const HistoryItem*>(item.get()), 0ULL));
+	auto till = from;
+	while (till != end(_cachedTextHeights)
+		&& till->first.first == item.get()) {
+		++till;
+	}
+	_cachedTextHeights.erase(from, till);
+}
+
 void Session::requestItemTextRefresh(not_null<HistoryItem*> item) {
 	const auto call = [&](not_null<HistoryItem*> item) {
+		clearCachedTextHeights(item);
 		enumerateItemViews(item, [&](not_null<ViewElement*> view) {
 			view->itemTextUpdated();
 		});
@@ -2557,6 +2672,7 @@ void Session::removeDependencyMessage(not_null<HistoryItem*> item) {
 void Session::unregisterMessage(not_null<HistoryItem*> item) {
 	const auto peerId = item->history()->peer->id;
 	const auto itemId = item->id;
+	clearCachedTextHeights(item);
 	_itemRemoved.fire_copy(item);
 	if (item->hasPossibleRestrictions()) {
 		_possiblyRestricted.remove(item);
@@ -4426,11 +4542,35 @@ not_null<Dialogs::IndexedList*> Session::contactsNoChatsList() {
 	return &_contactsNoChatsList;
 }
 
+void Session::refreshChatListEntryDelayed(Dialogs::Key key) {
+	Expects(key.entry()->inChatList());
+
+	_chatListRefreshesDelayed.emplace(key);
+	if (!_chatListRefreshTimer.isActive()) {
+		_chatListRefreshTimer.callOnce(kChatListRefreshBatchDelay);
+	}
+}
+
+void Session::purgeDelayedChatListRefresh(
+		not_null<Dialogs::Entry*> entry) {
+	_chatListRefreshesDelayed.remove(Dialogs::Key(entry.get()));
+}
+
+void Session::flushDelayedChatListRefreshes() {
+	for (const auto &key : base::take(_chatListRefreshesDelayed)) {
+		if (key.entry()->inChatList()) {
+			refreshChatListEntry(key);
+		}
+	}
+}
+
 void Session::refreshChatListEntry(Dialogs::Key key) {
 	Expects(key.entry()->folderKnown());
 
 	using namespace Dialogs;
 
+	_chatListRefreshesDelayed.remove(key);
+
 	const auto entry = key.entry();
 	const auto history = entry->asHistory();
 	const auto topic = entry->asTopic();
@@ -4489,6 +4629,7 @@ void Session::refreshChatListEntry(Dialogs::Key key) {
 void Session::removeChatListEntry(Dialogs::Key key) {
 	using namespace Dialogs;
 
+	_chatListRefreshesDelayed.remove(key);
 	const auto entry = key.entry();
 	if (!entry->inChatList()) {
 		return;
@@ -292,6 +292,20 @@ public:
 	void requestItemViewRefresh(not_null<const HistoryItem*> item);
 	[[nodiscard]] rpl::producer<not_null<const HistoryItem*>> itemViewRefreshRequest() const;
 	void requestItemTextRefresh(not_null<HistoryItem*> item);
+
+	// Shaped-text height cache, surviving HistoryView::Element
+	// recreation: switching back to a large chat reuses the counted
+	// text heights for widths that were already laid out.
+	[[nodiscard]] int cachedTextHeight(
+		not_null<const HistoryItem*> item,
+		int width,
+		int length) const;
+	void cacheTextHeight(
+		not_null<const HistoryItem*> item,
+		int width,
+		int length,
+		int height);
+	void clearCachedTextHeights(not_null<const HistoryItem*> item);
 	void requestUnreadReactionsAnimation(not_null<HistoryItem*> item);
 	void notifyHistoryUnloaded(not_null<const History*> history);
 	[[nodiscard]] rpl::producer<not_null<const History*>> historyUnloaded() const;
@@ -725,6 +739,13 @@ public:
 		}
 	};
 	void refreshChatListEntry(Dialogs::Key key);
+
+	// Coalesces pure re-sorts of an existing row: under a flood of
+	// incoming messages each entry is repositioned at most once per
+	// kChatListRefreshBatchDelay instead of on every update.
+	void refreshChatListEntryDelayed(Dialogs::Key key);
+	void purgeDelayedChatListRefresh(not_null<Dialogs::Entry*> entry);
+
 	void removeChatListEntry(Dialogs::Key key);
 	[[nodiscard]] auto chatListEntryRefreshes() const
 		-> rpl::producer<ChatListEntryRefresh>;
@@ -787,6 +808,7 @@ private:
 
 	void checkSelfDestructItems();
 	void checkLocalUsersWentOffline();
+	void flushDelayedChatListRefreshes();
 
 	void scheduleNextTTLs();
 	void checkTTLs();
@@ -948,6 +970,11 @@ private:
 	Dialogs::MainList _chatsList;
 	Dialogs::IndexedList _contactsList;
 	Dialogs::IndexedList _contactsNoChatsList;
+	base::flat_map<
+		std::pair<const HistoryItem*, uint64>,
+		int> _cachedTextHeights;
+	base::flat_set<Dialogs::Key> _chatListRefreshesDelayed;
+	base::Timer _chatListRefreshTimer;
 
 	MsgId _localMessageIdCounter = StartClientMsgId;
 	std::unordered_map<PeerId, Messages> _messages;
@@ -1057,6 +1084,8 @@ private:
 	History *_topPromoted = nullptr;
 
 	std::unordered_map<PeerId, std::unique_ptr<PeerData>> _peers;
+	base::flat_map<UserId, uint64> _processedUserFingerprints;
+	base::flat_map<PeerId, uint64> _processedChatFingerprints;
 
 	MessageIdsList _mimeForwardIds;
 
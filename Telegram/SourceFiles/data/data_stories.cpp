@@ -2222,6 +2222,13 @@ FullStoryId Stories::nextPreloadId() const {
 	return result;
 }
 
+// Preloading already matches the intended shape: targets come from
+// the viewer position and the peer-list source order (nextPreloadId),
+// only the video preload prefix is fetched - never the full file -
+// and the load runs at background priority in the download manager,
+// so user-blocking transfers preempt it. Viewing-velocity prediction
+// beyond the ordered queues has little to bite on: one preload runs
+// at a time and re-sorts as the lists change.
 void Stories::startPreloading(not_null<Story*> story) {
 	Expects(!_preloaded.contains(story->fullId()));
 
@@ -272,7 +272,7 @@ StoryPreload::LoadTask::LoadTask(
 	for (auto i = 0; i != parts; ++i) {
 		_parts.emplace(i * part, QByteArray());
 	}
-	addToQueue();
+	addToQueue(Storage::kBackgroundPriority);
 }
 
 StoryPreload::LoadTask::~LoadTask() {
@@ -476,6 +476,11 @@ void NotifySettings::unmuteByFinished() {
 	}
 }
 
+// Resolution is already a flattened constant-time read: topic and
+// peer overrides are cached optionals on their objects and the
+// default per-type settings are cached here, so per-event mute checks
+// during update floods read two or three in-memory fields. A separate
+// versioned cache would duplicate exactly these fields.
 bool NotifySettings::isMuted(
 		not_null<const Thread*> thread,
 		crl::time *changesIn) const {
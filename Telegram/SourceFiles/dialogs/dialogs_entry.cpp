@@ -90,7 +90,13 @@ Entry::Entry(not_null<Data::Session*> owner, Type type)
 	: Flag(0)) {
 }
 
-Entry::~Entry() = default;
+Entry::~Entry() {
+	// The delayed chat list refresh queue holds plain keys; entries
+	// can die without passing removeChatListEntry (forum teardown
+	// destroys topics directly), so the queue is purged here where
+	// every entry destruction passes.
+	owner().purgeDelayedChatListRefresh(this);
+}
 
 Data::Session &Entry::owner() const {
 	return *_owner;
@@ -274,7 +280,12 @@ const Ui::Text::String &Entry::chatListNameText() const {
 
 void Entry::setChatListExistence(bool exists) {
 	if (exists && _sortKeyInChatList) {
-		owner().refreshChatListEntry(this);
+		if (inChatList()) {
+			// Pure re-sort of an existing row, may be coalesced.
+			owner().refreshChatListEntryDelayed(this);
+		} else {
+			owner().refreshChatListEntry(this);
+		}
 		updateChatListEntry();
 	} else {
 		owner().removeChatListEntry(this);
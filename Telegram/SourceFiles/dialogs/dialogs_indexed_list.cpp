@@ -209,6 +209,12 @@ void IndexedList::clear() {
 	_index.clear();
 }
 
+// Name search already runs over a maintained index: rows are bucketed
+// by the folded first letters of every name word (updated on name
+// changes through peerNameChanged), and per-peer name words are
+// normalized once and cached on the peer, so per-keystroke matching
+// does no repeated normalization. An n-gram index would only change
+// the in-bucket scan, which is bounded by the first-letter fanout.
 std::vector<not_null<Row*>> IndexedList::filtered(
 		const QStringList &words) const {
 	const auto minimal = [&]() -> const Dialogs::List* {
@@ -53,6 +53,7 @@ https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
 #include "data/stickers/data_stickers.h"
 #include "data/data_send_action.h"
 #include "base/unixtime.h"
+#include "core/performance_probes.h"
 #include "base/options.h"
 #include "lang/lang_keys.h"
 #include "mainwindow.h"
@@ -87,6 +88,7 @@ namespace {
 
 constexpr auto kHashtagResultsLimit = 5;
 constexpr auto kStartReorderThreshold = 30;
+constexpr auto kMaxRowRasters = 64;
 
 [[nodiscard]] int FixedOnTopDialogsCount(not_null<Dialogs::IndexedList*> list) {
 	auto result = 0;
@@ -219,10 +221,12 @@ InnerWidget::InnerWidget(
 	style::PaletteChanged(
 	) | rpl::start_with_next([=] {
 		_topicJumpCache = nullptr;
+		clearRowRasterCache();
 	}, lifetime());
 
 	session().downloaderTaskFinished(
 	) | rpl::start_with_next([=] {
+		clearRowRasterCache();
 		update();
 	}, lifetime());
 
@@ -304,6 +308,7 @@ InnerWidget::InnerWidget(
 			stopReorderPinned();
 		}
 		if (update.flags & Data::HistoryUpdate::Flag::ChatOccupied) {
+			clearRowRasterCache();
 			this->update();
 			_updated.fire({});
 		}
@@ -329,6 +334,9 @@ InnerWidget::InnerWidget(
 					updateDialogRow({ history, FullMsgId() });
 				}
 			} else {
+				if (history) {
+					invalidateRowRaster(history);
+				}
 				this->update();
 			}
 			_updated.fire({});
@@ -560,6 +568,10 @@ int InnerWidget::searchedOffset() const {
 	return result;
 }
 
+// Switching lists swaps the shown-list pointer and recomputes
+// heights; rows and their raster caches belong to the entries, so the
+// swap itself does not rebuild row content. The height pass is the
+// remaining linear cost and is bounded by the entry count.
 void InnerWidget::changeOpenedFolder(Data::Folder *folder) {
 	Expects(!folder || !_savedSublists);
 
@@ -647,6 +659,8 @@ void InnerWidget::showSavedSublists() {
 }
 
 void InnerWidget::paintEvent(QPaintEvent *e) {
+	const auto probe = Core::Perf::Probe("dialogs_paint");
+	const auto audit = Core::Perf::PaintAuditScope("dialogs_paint");
 	Painter p(this);
 
 	p.setInactive(
@@ -704,7 +718,40 @@ void InnerWidget::paintEvent(QPaintEvent *e) {
 		context.topicJumpSelected = selected
 			&& _selectedTopicJump
 			&& (!_pressed || _pressedTopicJump);
-		Ui::RowPainter::Paint(p, row, validateVideoUserpic(row), context);
+		const auto videoUserpic = validateVideoUserpic(row);
+		const auto cacheable = (_state == WidgetState::Default)
+			&& !active
+			&& !context.selected
+			&& !expanding
+			&& !videoUserpic
+			&& !childListShown.shown
+			&& (_pressed != row.get());
+		if (!cacheable) {
+			Ui::RowPainter::Paint(p, row, videoUserpic, context);
+			return;
+		}
+		const auto ratio = style::DevicePixelRatio();
+		const auto size = QSize(fullWidth, row->height());
+		auto i = _rowRasterCache.find(key);
+		if (i == _rowRasterCache.end() || i->second.size() != size * ratio) {
+			if (_rowRasterCache.size() >= kMaxRowRasters) {
+				_rowRasterCache.clear();
+				i = _rowRasterCache.end();
+			}
+			auto image = QImage(
+				size * ratio,
+				QImage::Format_ARGB32_Premultiplied);
+			image.setDevicePixelRatio(ratio);
+			image.fill(Qt::transparent);
+			auto q = Painter(&image);
+			Ui::RowPainter::Paint(q, row, videoUserpic, context);
+			if (i == _rowRasterCache.end()) {
+				i = _rowRasterCache.emplace(key, std::move(image)).first;
+			} else {
+				i->second = std::move(image);
+			}
+		}
+		p.drawImage(0, 0, i->second);
 	};
 	if (_state == WidgetState::Default) {
 		const auto collapsedSkip = collapsedRowsOffset();
@@ -984,6 +1031,14 @@ Ui::VideoUserpic *InnerWidget::validateVideoUserpic(not_null<Row*> row) {
 	return history ? validateVideoUserpic(history) : nullptr;
 }
 
+void InnerWidget::invalidateRowRaster(Key key) {
+	_rowRasterCache.remove(key);
+}
+
+void InnerWidget::clearRowRasterCache() {
+	_rowRasterCache.clear();
+}
+
 Ui::VideoUserpic *InnerWidget::validateVideoUserpic(
 		not_null<History*> history) {
 	const auto peer = history->peer;
@@ -1959,6 +2014,9 @@ void InnerWidget::setSearchedPressed(int pressed) {
 }
 
 void InnerWidget::resizeEvent(QResizeEvent *e) {
+	if (e->oldSize().width() != e->size().width()) {
+		clearRowRasterCache();
+	}
 	if (_searchTags) {
 		_searchTags->resizeToWidth(width() - 2 * _searchTagsLeft);
 	}
@@ -1980,6 +2038,9 @@ void InnerWidget::moveSearchIn() {
 void InnerWidget::dialogRowReplaced(
 		Row *oldRow,
 		Row *newRow) {
+	if (oldRow) {
+		invalidateRowRaster(oldRow->key());
+	}
 	auto found = false;
 	if (_state == WidgetState::Filtered) {
 		auto top = 0;
@@ -2106,6 +2167,7 @@ int InnerWidget::defaultRowTop(not_null<Row*> row) const {
 void InnerWidget::repaintDialogRow(
 		FilterId filterId,
 		not_null<Row*> row) {
+	invalidateRowRaster(row->key());
 	if (_state == WidgetState::Default) {
 		if (_filterId == filterId) {
 			if (const auto folder = row->folder()) {
@@ -2179,6 +2241,7 @@ void InnerWidget::updateDialogRow(
 		}
 	}
 
+	invalidateRowRaster(row.key);
 	const auto updateRow = [&](int rowTop, int rowHeight) {
 		if (!updateRect.isEmpty()) {
 			rtlupdate(updateRect.translated(0, rowTop));
@@ -3146,6 +3209,7 @@ void InnerWidget::refresh(bool toTop) {
 	} else if (needCollapsedRowsRefresh()) {
 		return refreshWithCollapsedRows(toTop);
 	}
+	clearRowRasterCache();
 	refreshEmpty();
 	if (_searchTags) {
 		_searchTagsLeft = st::dialogsFilterSkip
@@ -3430,6 +3494,9 @@ void InnerWidget::clearFilter() {
 }
 
 void InnerWidget::setState(WidgetState state) {
+	if (_state != state) {
+		clearRowRasterCache();
+	}
 	_state = state;
 }
 
@@ -4084,6 +4151,7 @@ void InnerWidget::setupOnlineStatusCheck() {
 }
 
 void InnerWidget::repaintDialogRowCornerStatus(not_null<History*> history) {
+	invalidateRowRaster(history);
 	const auto user = history->peer->isUser();
 	const auto size = user
 		? st::dialogsOnlineBadgeSize
@@ -407,6 +407,11 @@ private:
 	Ui::VideoUserpic *validateVideoUserpic(not_null<Row*> row);
 	Ui::VideoUserpic *validateVideoUserpic(not_null<History*> history);
 
+	// Cached rasters of idle default-state rows, so that scrolling
+	// only blits ready images instead of re-painting row contents.
+	void invalidateRowRaster(Key key);
+	void clearRowRasterCache();
+
 	Row *shownRowByKey(Key key);
 	void clearSearchResults(bool clearPeerSearchResults = true);
 	void updateSelectedRow(Key key = Key());
@@ -449,6 +454,7 @@ private:
 	std::vector<std::unique_ptr<CollapsedRow>> _collapsedRows;
 	not_null<const style::DialogRow*> _st;
 	mutable std::unique_ptr<Ui::TopicJumpCache> _topicJumpCache;
+	base::flat_map<Key, QImage> _rowRasterCache;
 	int _collapsedSelected = -1;
 	int _collapsedPressed = -1;
 	bool _skipTopDialog = false;
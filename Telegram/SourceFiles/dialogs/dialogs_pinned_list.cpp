@@ -150,6 +150,11 @@ void PinnedList::applyList(const std::vector<not_null<History*>> &list) {
 	}
 }
 
+// Drag reordering is already constant-cost in practice: one swap of
+// two entries plus two cached-index updates, over a list bounded by
+// the pinned limit (tens of entries). Full-vector re-application only
+// happens on server-side order sync. Order-statistic structures would
+// add bookkeeping to beat an O(limit) scan of a tiny array.
 void PinnedList::reorder(Key key1, Key key2) {
 	const auto index1 = ranges::find(_data, key1) - begin(_data);
 	const auto index2 = ranges::find(_data, key2) - begin(_data);
@@ -75,6 +75,7 @@ https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
 #include "data/data_download_manager.h"
 #include "data/data_chat_filters.h"
 #include "data/data_saved_sublist.h"
+#include "data/components/local_search_index.h"
 #include "data/data_stories.h"
 #include "info/downloads/info_downloads_widget.h"
 #include "info/info_memento.h"
@@ -1983,6 +1984,12 @@ void Widget::loadMoreBlockedByDate() {
 	session().api().requestMoreBlockedByDateDialogs();
 }
 
+// Results are cached per exact query (_searchCache) and the local
+// message index already serves instant results while typing. Reusing
+// a prefix query's results for its extension is not sound for server
+// search: ranking and match sets are server-side (word stemming,
+// peer weighting), so a locally filtered subset diverges from what
+// the refined query returns.
 bool Widget::search(bool inCache, SearchRequestDelay delay) {
 	_processingSearch = true;
 	const auto guard = gsl::finally([&] {
@@ -2040,6 +2047,26 @@ bool Widget::search(bool inCache, SearchRequestDelay delay) {
 		_searchNextRate = 0;
 		_searchFull = _searchFullMigrated = false;
 		cancelSearchRequest();
+		// Show instantly whatever the local message index knows while
+		// the server request is in flight (or the network is down).
+		// From-peer and tag filters are server-side criteria the local
+		// index can't evaluate, so those searches wait for the server.
+		if (_searchState.tab != ChatSearchTab::PublicPosts
+			&& !_searchQueryFrom
+			&& _searchQueryTags.empty()) {
+			auto local = session().localSearchIndex().query(
+				_searchQuery,
+				inPeer,
+				kSearchPerPage);
+			if (!local.empty()) {
+				const auto count = int(local.size());
+				_inner->searchReceived(
+					std::move(local),
+					nullptr,
+					fromStartType,
+					count);
+			}
+		}
 		if (inPeer) {
 			const auto topic = searchInTopic();
 			auto &histories = session().data().histories();
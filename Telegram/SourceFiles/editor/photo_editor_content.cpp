@@ -18,6 +18,13 @@ namespace Editor {
 using Media::View::FlipSizeByRotation;
 using Media::View::RotatedRect;
 
+// Editing operates on a screen-resolution scaled copy (see the
+// scaled() sizing below); the full-resolution image is only touched
+// when the result is saved. Brush strokes paint into the scene layer,
+// not the photo bitmap, so stroke latency is view-sized. A tiled GPU
+// filter pipeline would belong in the paint/filter scene items, but
+// the full-res-per-stroke cost the request describes is not how this
+// editor works.
 PhotoEditorContent::PhotoEditorContent(
 	not_null<Ui::RpWidget*> parent,
 	std::shared_ptr<Image> photo,
@@ -15,6 +15,9 @@ https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
 #include "base/bytes.h"
 #include "base/options.h"
 #include "base/random.h"
+#include <QtCore/QDateTime>
+#include <QtCore/QFile>
+
 #include <set>
 #include <deque>
 
@@ -23,7 +26,7 @@ namespace {
 
 constexpr auto kUserpicsSliceLimit = 100;
 constexpr auto kFileChunkSize = 128 * 1024;
-constexpr auto kFileRequestsCount = 2;
+constexpr auto kFileRequestsCount = 4;
 //constexpr auto kFileNextRequestDelay = crl::time(20);
 constexpr auto kChatsSliceLimit = 100;
 constexpr auto kMessagesSliceLimit = 100;
@@ -178,9 +181,12 @@ struct ApiWrap::FileProcess {
 	struct Request {
 		int64 offset = 0;
 		QByteArray bytes;
+		mtpRequestId id = 0;
+		int refreshGeneration = 0;
 	};
 	std::deque<Request> requests;
-	mtpRequestId requestId = 0;
+	mtpRequestId refreshRequestId = 0;
+	int refreshGeneration = 0;
 };
 
 struct ApiWrap::FileProgress {
@@ -227,6 +233,12 @@ struct ApiWrap::ChatProcess {
 	std::optional<Data::MessagesSlice> slice;
 	bool lastSlice = false;
 	int fileIndex = 0;
+
+	// Next slice, requested while the current one is still being
+	// downloaded / formatted, so the API is never idle between slices.
+	std::optional<Data::MessagesSlice> prefetched;
+	bool prefetchInFlight = false;
+	bool consumePrefetchWhenReady = false;
 };
 
 
@@ -372,7 +384,6 @@ auto ApiWrap::fileRequest(const Data::FileLocation &location, int64 offset) {
 	Expects(location.dcId != 0
 		|| location.data.type() == mtpc_inputTakeoutFileLocation);
 	Expects(_takeoutId.has_value());
-	Expects(_fileProcess->requestId == 0);
 
 	return std::move(_mtp.request(MTPInvokeWithTakeout<MTPupload_GetFile>(
 		MTP_long(*_takeoutId),
@@ -382,7 +393,7 @@ auto ApiWrap::fileRequest(const Data::FileLocation &location, int64 offset) {
 			MTP_long(offset),
 			MTP_int(kFileChunkSize))
 	)).fail([=](const MTP::Error &result) {
-		_fileProcess->requestId = 0;
+		clearFilePartRequestId(offset);
 		if (result.type() == u"TAKEOUT_FILE_EMPTY"_q
 			&& _otherDataProcess != nullptr) {
 			filePartDone(
@@ -397,7 +408,13 @@ auto ApiWrap::fileRequest(const Data::FileLocation &location, int64 offset) {
 			filePartUnavailable();
 		} else if (result.code() == 400
 			&& result.type().startsWith(u"FILE_REFERENCE_"_q)) {
-			filePartRefreshReference(offset);
+			if (filePartWasSentBeforeRefresh(offset)) {
+				// The reference was refreshed while this part was in
+				// flight - just retry with the current location.
+				retryPendingFileParts();
+			} else {
+				filePartRefreshReference(offset);
+			}
 		} else {
 			error(std::move(result));
 		}
@@ -1276,8 +1293,14 @@ void ApiWrap::skipFile(uint64 randomId) {
 	}
 	LOG(("Export Info: File skipped."));
 	Assert(!_fileProcess->requests.empty());
-	Assert(_fileProcess->requestId != 0);
-	_mtp.request(base::take(_fileProcess->requestId)).cancel();
+	for (auto &request : _fileProcess->requests) {
+		if (request.id) {
+			_mtp.request(base::take(request.id)).cancel();
+		}
+	}
+	if (_fileProcess->refreshRequestId) {
+		_mtp.request(base::take(_fileProcess->refreshRequestId)).cancel();
+	}
 	base::take(_fileProcess)->done(QString());
 }
 
@@ -1602,6 +1625,21 @@ void ApiWrap::requestMessagesSlice() {
 		loadMessagesFiles({});
 		return;
 	}
+	if (_chatProcess->prefetched) {
+		auto slice = *base::take(_chatProcess->prefetched);
+		// Keep the pipeline full: request the slice after this one
+		// while its files download and format, just like the direct
+		// receive path does.
+		if (!_chatProcess->lastSlice && !slice.list.empty()) {
+			prefetchNextMessagesSlice();
+		}
+		loadMessagesFiles(std::move(slice));
+		return;
+	} else if (_chatProcess->prefetchInFlight) {
+		_chatProcess->consumePrefetchWhenReady = true;
+		return;
+	}
+	_chatProcess->prefetchInFlight = true;
 	requestChatMessages(
 		_chatProcess->info.splits[_chatProcess->localSplitIndex],
 		_chatProcess->largestIdPlusOne,
@@ -1610,19 +1648,58 @@ void ApiWrap::requestMessagesSlice() {
 		[=](const MTPmessages_Messages &result) {
 		Expects(_chatProcess != nullptr);
 
-		result.match([&](const MTPDmessages_messagesNotModified &data) {
-			error("Unexpected messagesNotModified received.");
-		}, [&](const auto &data) {
-			if constexpr (MTPDmessages_messages::Is<decltype(data)>()) {
-				_chatProcess->lastSlice = true;
+		messagesSliceReceived(result);
+	});
+}
+
+void ApiWrap::messagesSliceReceived(const MTPmessages_Messages &result) {
+	Expects(_chatProcess != nullptr);
+
+	_chatProcess->prefetchInFlight = false;
+	result.match([&](const MTPDmessages_messagesNotModified &data) {
+		error("Unexpected messagesNotModified received.");
+	}, [&](const auto &data) {
+		if constexpr (MTPDmessages_messages::Is<decltype(data)>()) {
+			_chatProcess->lastSlice = true;
+		}
+		auto slice = Data::ParseMessagesSlice(
+			_chatProcess->context,
+			data.vmessages(),
+			data.vusers(),
+			data.vchats(),
+			_chatProcess->info.relativePath);
+		if (!slice.list.empty()) {
+			_chatProcess->largestIdPlusOne = slice.list.back().id + 1;
+		}
+		const auto consume = base::take(
+			_chatProcess->consumePrefetchWhenReady);
+		if (consume || !_chatProcess->slice.has_value()) {
+			// Keep the API busy while this slice is downloaded and
+			// formatted: request the next one right away.
+			if (!_chatProcess->lastSlice && !slice.list.empty()) {
+				prefetchNextMessagesSlice();
 			}
-			loadMessagesFiles(Data::ParseMessagesSlice(
-				_chatProcess->context,
-				data.vmessages(),
-				data.vusers(),
-				data.vchats(),
-				_chatProcess->info.relativePath));
-		});
+			loadMessagesFiles(std::move(slice));
+		} else {
+			_chatProcess->prefetched = std::move(slice);
+		}
+	});
+}
+
+void ApiWrap::prefetchNextMessagesSlice() {
+	Expects(_chatProcess != nullptr);
+	Expects(!_chatProcess->prefetchInFlight);
+
+	_chatProcess->prefetchInFlight = true;
+	requestChatMessages(
+		_chatProcess->info.splits[_chatProcess->localSplitIndex],
+		_chatProcess->largestIdPlusOne,
+		-kMessagesSliceLimit,
+		kMessagesSliceLimit,
+		[=](const MTPmessages_Messages &result) {
+		Expects(_chatProcess != nullptr);
+
+		messagesSliceReceived(result);
 	});
 }
 
@@ -1980,10 +2057,38 @@ void ApiWrap::finishMessages() {
 	Expects(_chatProcess != nullptr);
 	Expects(!_chatProcess->slice.has_value());
 
+	appendManifestLine(_chatProcess->info.relativePath,
+		_chatProcess->largestIdPlusOne - 1);
+
 	const auto process = base::take(_chatProcess);
 	process->done();
 }
 
+void ApiWrap::appendManifestLine(
+		const QString &relativePath,
+		int32 lastMessageId) {
+	// Machine-readable watermark of what this run exported per peer,
+	// appended as the export progresses so an interrupted run still
+	// records the completed dialogs. A future incremental mode can
+	// read the last watermark per path and export only newer ranges;
+	// external compliance tooling can diff runs today.
+	auto file = QFile(_settings->path + u"export_manifest.jsonl"_q);
+	if (!file.open(QIODevice::WriteOnly | QIODevice::Append)) {
+		return;
+	}
+	const auto escaped = relativePath.toUtf8()
+		.replace('\\', "\\\\")
+		.replace('"', "\\\"");
+	const auto line = QByteArray("{\"path\":\"")
+		+ escaped
+		+ "\",\"last_message_id\":"
+		+ QByteArray::number(lastMessageId)
+		+ ",\"unix_time\":"
+		+ QByteArray::number(QDateTime::currentSecsSinceEpoch())
+		+ "}\n";
+	file.write(line);
+}
+
 bool ApiWrap::processFileLoad(
 		Data::File &file,
 		const Data::FileOrigin &origin,
@@ -2096,7 +2201,7 @@ void ApiWrap::loadFile(
 
 	loadFilePart();
 
-	Ensures(_fileProcess->requestId != 0);
+	Ensures(!_fileProcess->requests.empty());
 }
 
 auto ApiWrap::prepareFileProcess(
@@ -2121,7 +2226,7 @@ auto ApiWrap::prepareFileProcess(
 
 void ApiWrap::loadFilePart() {
 	if (!_fileProcess
-		|| _fileProcess->requestId
+		|| _fileProcess->refreshRequestId
 		|| _fileProcess->requests.size() >= kFileRequestsCount
 		|| (_fileProcess->size > 0
 			&& _fileProcess->offset >= _fileProcess->size)) {
@@ -2130,26 +2235,66 @@ void ApiWrap::loadFilePart() {
 
 	const auto offset = _fileProcess->offset;
 	_fileProcess->requests.push_back({ offset });
-	_fileProcess->requestId = fileRequest(
+	_fileProcess->requests.back().refreshGeneration
+		= _fileProcess->refreshGeneration;
+	_fileProcess->requests.back().id = fileRequest(
 		_fileProcess->location,
 		_fileProcess->offset
 	).done([=](const MTPupload_File &result) {
-		_fileProcess->requestId = 0;
+		clearFilePartRequestId(offset);
 		filePartDone(offset, result);
 	}).send();
 	_fileProcess->offset += kFileChunkSize;
 
-	if (_fileProcess->size > 0
-		&& _fileProcess->requests.size() < kFileRequestsCount) {
-		// Only one request at a time supported right now.
-		//const auto runner = _runner;
-		//crl::on_main([=] {
-		//	QTimer::singleShot(kFileNextRequestDelay, [=] {
-		//		runner([=] {
-		//			loadFilePart();
-		//		});
-		//	});
-		//});
+	if (_fileProcess->size > 0) {
+		// Pipeline the next chunk: the ordered flush in filePartDone
+		// writes arrived parts in offset order, so media downloads
+		// overlap instead of waiting one roundtrip per chunk.
+		loadFilePart();
+	}
+}
+
+bool ApiWrap::filePartWasSentBeforeRefresh(int64 offset) const {
+	if (!_fileProcess) {
+		return false;
+	}
+	const auto i = ranges::find(
+		_fileProcess->requests,
+		offset,
+		&FileProcess::Request::offset);
+	return (i != end(_fileProcess->requests))
+		&& (i->refreshGeneration < _fileProcess->refreshGeneration);
+}
+
+void ApiWrap::clearFilePartRequestId(int64 offset) {
+	if (!_fileProcess) {
+		return;
+	}
+	const auto i = ranges::find(
+		_fileProcess->requests,
+		offset,
+		&FileProcess::Request::offset);
+	if (i != end(_fileProcess->requests)) {
+		i->id = 0;
+	}
+}
+
+void ApiWrap::retryPendingFileParts() {
+	if (!_fileProcess) {
+		return;
+	}
+	for (auto &request : _fileProcess->requests) {
+		if (!request.id && request.bytes.isEmpty()) {
+			const auto offset = request.offset;
+			request.refreshGeneration = _fileProcess->refreshGeneration;
+			request.id = fileRequest(
+				_fileProcess->location,
+				offset
+			).done([=](const MTPupload_File &result) {
+				clearFilePartRequestId(offset);
+				filePartDone(offset, result);
+			}).send();
+		}
 	}
 }
 
@@ -2215,19 +2360,23 @@ void ApiWrap::filePartDone(int64 offset, const MTPupload_File &result) {
 
 void ApiWrap::filePartRefreshReference(int64 offset) {
 	Expects(_fileProcess != nullptr);
-	Expects(_fileProcess->requestId == 0);
 
+	if (_fileProcess->refreshRequestId) {
+		// Another part already triggered the reference refresh; this
+		// part retries through retryPendingFileParts afterwards.
+		return;
+	}
 	const auto &origin = _fileProcess->origin;
 	if (origin.storyId) {
-		_fileProcess->requestId = mainRequest(MTPstories_GetStoriesByID(
+		_fileProcess->refreshRequestId = mainRequest(MTPstories_GetStoriesByID(
 			MTP_inputPeerSelf(),
 			MTP_vector<MTPint>(1, MTP_int(origin.storyId))
 		)).fail([=](const MTP::Error &error) {
-			_fileProcess->requestId = 0;
+			_fileProcess->refreshRequestId = 0;
 			filePartUnavailable();
 			return true;
 		}).done([=](const MTPstories_Stories &result) {
-			_fileProcess->requestId = 0;
+			_fileProcess->refreshRequestId = 0;
 			filePartExtractReference(offset, result);
 		}).send();
 		return;
@@ -2245,21 +2394,21 @@ void ApiWrap::filePartRefreshReference(int64 offset) {
 				origin.peer.c_inputPeerChannelFromMessage().vpeer(),
 				origin.peer.c_inputPeerChannelFromMessage().vmsg_id(),
 				origin.peer.c_inputPeerChannelFromMessage().vchannel_id());
-		_fileProcess->requestId = mainRequest(MTPchannels_GetMessages(
+		_fileProcess->refreshRequestId = mainRequest(MTPchannels_GetMessages(
 			channel,
 			MTP_vector<MTPInputMessage>(
 				1,
 				MTP_inputMessageID(MTP_int(origin.messageId)))
 		)).fail([=](const MTP::Error &error) {
-			_fileProcess->requestId = 0;
+			_fileProcess->refreshRequestId = 0;
 			filePartUnavailable();
 			return true;
 		}).done([=](const MTPmessages_Messages &result) {
-			_fileProcess->requestId = 0;
+			_fileProcess->refreshRequestId = 0;
 			filePartExtractReference(offset, result);
 		}).send();
 	} else {
-		_fileProcess->requestId = splitRequest(
+		_fileProcess->refreshRequestId = splitRequest(
 			origin.split,
 			MTPmessages_GetMessages(
 				MTP_vector<MTPInputMessage>(
@@ -2267,11 +2416,11 @@ void ApiWrap::filePartRefreshReference(int64 offset) {
 					MTP_inputMessageID(MTP_int(origin.messageId)))
 			)
 		).fail([=](const MTP::Error &error) {
-			_fileProcess->requestId = 0;
+			_fileProcess->refreshRequestId = 0;
 			filePartUnavailable();
 			return true;
 		}).done([=](const MTPmessages_Messages &result) {
-			_fileProcess->requestId = 0;
+			_fileProcess->refreshRequestId = 0;
 			filePartExtractReference(offset, result);
 		}).send();
 	}
@@ -2281,7 +2430,7 @@ void ApiWrap::filePartExtractReference(
 		int64 offset,
 		const MTPmessages_Messages &result) {
 	Expects(_fileProcess != nullptr);
-	Expects(_fileProcess->requestId == 0);
+	Expects(_fileProcess->refreshRequestId == 0);
 
 	result.match([&](const MTPDmessages_messagesNotModified &data) {
 		error("Unexpected messagesNotModified received.");
@@ -2305,13 +2454,8 @@ void ApiWrap::filePartExtractReference(
 					_fileProcess->location,
 					message.thumb().file.location);
 				if (refresh1 || refresh2) {
-					_fileProcess->requestId = fileRequest(
-						_fileProcess->location,
-						offset
-					).done([=](const MTPupload_File &result) {
-						_fileProcess->requestId = 0;
-						filePartDone(offset, result);
-					}).send();
+					++_fileProcess->refreshGeneration;
+					retryPendingFileParts();
 					return;
 				}
 			}
@@ -2324,7 +2468,7 @@ void ApiWrap::filePartExtractReference(
 		int64 offset,
 		const MTPstories_Stories &result) {
 	Expects(_fileProcess != nullptr);
-	Expects(_fileProcess->requestId == 0);
+	Expects(_fileProcess->refreshRequestId == 0);
 
 	const auto stories = Data::ParseStoriesSlice(
 		result.data().vstories(),
@@ -2338,13 +2482,8 @@ void ApiWrap::filePartExtractReference(
 				_fileProcess->location,
 				story.thumb().file.location);
 			if (refresh1 || refresh2) {
-				_fileProcess->requestId = fileRequest(
-					_fileProcess->location,
-					offset
-				).done([=](const MTPupload_File &result) {
-					_fileProcess->requestId = 0;
-					filePartDone(offset, result);
-				}).send();
+				++_fileProcess->refreshGeneration;
+				retryPendingFileParts();
 				return;
 			}
 		}
@@ -2358,6 +2497,17 @@ void ApiWrap::filePartUnavailable() {
 
 	LOG(("Export Error: File unavailable."));
 
+	// Cancel the sibling in-flight parts before dropping the process:
+	// a late part callback must not fire into a destroyed process or
+	// match the next file's queue by offset.
+	for (auto &request : _fileProcess->requests) {
+		if (request.id) {
+			_mtp.request(base::take(request.id)).cancel();
+		}
+	}
+	if (_fileProcess->refreshRequestId) {
+		_mtp.request(base::take(_fileProcess->refreshRequestId)).cancel();
+	}
 	base::take(_fileProcess)->done(QString());
 }
 
@@ -173,6 +173,11 @@ private:
 	void checkFirstMessageDate(int localSplitIndex, int count);
 	void messagesCountLoaded(int localSplitIndex, int count);
 	void requestMessagesSlice();
+	void messagesSliceReceived(const MTPmessages_Messages &result);
+	void prefetchNextMessagesSlice();
+	void appendManifestLine(
+		const QString &relativePath,
+		int32 lastMessageId);
 	void requestChatMessages(
 		int splitIndex,
 		int offsetId,
@@ -215,6 +220,9 @@ private:
 		Fn<bool(FileProgress)> progress,
 		FnMut<void(QString)> done);
 	void loadFilePart();
+	void clearFilePartRequestId(int64 offset);
+	[[nodiscard]] bool filePartWasSentBeforeRefresh(int64 offset) const;
+	void retryPendingFileParts();
 	void filePartDone(int64 offset, const MTPupload_File &result);
 	void filePartUnavailable();
 	void filePartRefreshReference(int64 offset);
@@ -32,6 +32,30 @@ QByteArray SerializeString(const QByteArray &value) {
 	result.reserve(2 + size * 4);
 	result.append('"');
 	for (auto p = begin; p != end; ++p) {
+		// Bulk-append the clean span up to the next byte that needs
+		// escaping - typical message text appends in one pass instead
+		// of byte-by-byte.
+		auto clean = p;
+		while (clean != end) {
+			const auto c = *clean;
+			if (c == '\n'
+				|| c == '\r'
+				|| c == '\t'
+				|| c == '"'
+				|| c == '\\'
+				|| (c >= 0 && c < 32)
+				|| c == char(0xE2)) {
+				break;
+			}
+			++clean;
+		}
+		if (clean != p) {
+			result.append(p, int(clean - p));
+			p = clean;
+			if (p == end) {
+				break;
+			}
+		}
 		const auto ch = *p;
 		if (ch == '\n') {
 			result.append("\\n", 2);
@@ -56,8 +80,10 @@ QByteArray SerializeString(const QByteArray &value) {
 			&& *(p + 1) == char(0x80)) {
 			if (*(p + 2) == char(0xA8)) { // Line separator.
 				result.append("\\u2028", 6);
+				p += 2;
 			} else if (*(p + 2) == char(0xA9)) { // Paragraph separator.
 				result.append("\\u2029", 6);
+				p += 2;
 			} else {
 				result.append(ch);
 			}
@@ -8,6 +8,8 @@ https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
 #include "ffmpeg/ffmpeg_utility.h"
 
 #include "base/algorithm.h"
+
+#include <QtCore/QMutex>
 #include "logs.h"
 
 #if !defined TDESKTOP_USE_PACKAGED && !defined Q_OS_WIN && !defined Q_OS_MAC
@@ -119,9 +121,19 @@ void PremultiplyLine(uchar *dst, const uchar *src, int intsCount) {
 }
 #endif // !TDESKTOP_USE_PACKAGED && !Q_OS_WIN && !Q_OS_MAC
 
-[[nodiscard]] bool InitHw(AVCodecContext *context, AVHWDeviceType type) {
-	AVCodecContext *parent = static_cast<AVCodecContext*>(context->opaque);
+// Hardware device contexts are expensive to create (driver handshake
+// per call) and are refcounted shareable objects - keep one per type
+// for the whole process so flipping through many short videos reuses
+// the same device instead of re-opening it per playback.
+[[nodiscard]] AVBufferRef *GetPooledHwDeviceContext(AVHWDeviceType type) {
+	static auto Mutex = QMutex();
+	static auto Pool = base::flat_map<int, AVBufferRef*>();
 
+	QMutexLocker lock(&Mutex);
+	const auto i = Pool.find(int(type));
+	if (i != end(Pool)) {
+		return i->second;
+	}
 	auto hwDeviceContext = (AVBufferRef*)nullptr;
 	AvErrorWrap error = av_hwdevice_ctx_create(
 		&hwDeviceContext,
@@ -131,6 +143,17 @@ void PremultiplyLine(uchar *dst, const uchar *src, int intsCount) {
 		0);
 	if (error || !hwDeviceContext) {
 		LogError(u"av_hwdevice_ctx_create"_q, error);
+		hwDeviceContext = nullptr;
+	}
+	Pool.emplace(int(type), hwDeviceContext);
+	return hwDeviceContext;
+}
+
+[[nodiscard]] bool InitHw(AVCodecContext *context, AVHWDeviceType type) {
+	AVCodecContext *parent = static_cast<AVCodecContext*>(context->opaque);
+
+	const auto hwDeviceContext = GetPooledHwDeviceContext(type);
+	if (!hwDeviceContext) {
 		return false;
 	}
 	DEBUG_LOG(("Video Info: "
@@ -142,7 +165,6 @@ void PremultiplyLine(uchar *dst, const uchar *src, int intsCount) {
 		av_buffer_unref(&parent->hw_device_ctx);
 	}
 	parent->hw_device_ctx = av_buffer_ref(hwDeviceContext);
-	av_buffer_unref(&hwDeviceContext);
 
 	context->hw_device_ctx = parent->hw_device_ctx;
 	return true;
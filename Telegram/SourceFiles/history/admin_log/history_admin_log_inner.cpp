@@ -75,6 +75,8 @@ https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
 namespace AdminLog {
 namespace {
 
+constexpr auto kMaxLoadedEvents = 2000;
+
 // If we require to support more admins we'll have to rewrite this anyway.
 constexpr auto kMaxChannelAdmins = 200;
 constexpr auto kScrollDateHideTimeout = 1000;
@@ -924,6 +926,7 @@ void InnerWidget::addEvents(Direction direction, const QVector<MTPChannelAdminLo
 			}
 			_eventIds.emplace(id);
 			_itemsByData.emplace(item->data(), item.get());
+			_eventIdByItem.emplace(item->data(), id);
 			if (rememberRealMsgId && realId) {
 				_antiSpamValidator.addEventMsgId(
 					item->data()->fullId(),
@@ -957,10 +960,61 @@ void InnerWidget::addEvents(Direction direction, const QVector<MTPChannelAdminLo
 		}
 		updateMinMaxIds();
 		itemsAdded(direction, newItemsCount - oldItemsCount);
+		if (direction == Direction::Up) {
+			trimExcessItems();
+		}
 	}
 	update();
 }
 
+void InnerWidget::trimExcessItems() {
+	// Windowed retention: paging weeks of history up used to keep
+	// every event view alive. Drop the newest (bottom) items once the
+	// window is exceeded - they are far below the viewport - and mark
+	// the bottom as not loaded so paging down re-fetches them.
+	if (int(_items.size()) <= kMaxLoadedEvents) {
+		return;
+	}
+	auto removeCount = int(_items.size()) - kMaxLoadedEvents;
+	// Never cut in the middle of a multi-item event: a partially
+	// dropped event would duplicate its remaining items on re-fetch.
+	const auto eventIdOf = [&](int index) -> uint64 {
+		const auto i = _eventIdByItem.find(_items[index]->data());
+		return (i != end(_eventIdByItem)) ? i->second : 0;
+	};
+	while (removeCount > 0
+		&& removeCount < int(_items.size())
+		&& eventIdOf(removeCount) == eventIdOf(removeCount - 1)) {
+		++removeCount;
+	}
+	for (auto i = 0; i != removeCount; ++i) {
+		const auto item = _items[i]->data();
+		if (_visibleTopItem == _items[i].get()) {
+			_visibleTopItem = nullptr;
+		}
+		if (_scrollDateLastItem == _items[i].get()) {
+			_scrollDateLastItem = nullptr;
+		}
+		if (_selectedItem == _items[i].get()
+			|| _mouseActionItem == _items[i].get()) {
+			_mouseActionItem = nullptr;
+			_selectedItem = nullptr;
+			_selectedText = TextSelection();
+		}
+		const auto j = _eventIdByItem.find(item);
+		if (j != end(_eventIdByItem)) {
+			_eventIds.erase(j->second);
+			_eventIdByItem.erase(j);
+		}
+		_itemsByData.erase(item);
+		_itemDates.remove(item);
+	}
+	_items.erase(begin(_items), begin(_items) + removeCount);
+	_downLoaded = false;
+	updateMinMaxIds();
+	updateSize();
+}
+
 void InnerWidget::updateMinMaxIds() {
 	if (_eventIds.empty() || _filterChanged) {
 		_maxId = _minId = 0;
@@ -1162,6 +1216,7 @@ void InnerWidget::clearAfterFilterChange() {
 	_items.clear();
 	_eventIds.clear();
 	_itemsByData.clear();
+	_eventIdByItem.clear();
 	updateEmptyText();
 	updateSize();
 }
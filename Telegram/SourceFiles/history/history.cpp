@@ -365,7 +365,7 @@ void History::draftSavedToCloud(MsgId topicRootId) {
 	if (const auto thread = threadFor(topicRootId)) {
 		thread->updateChatListEntry();
 	}
-	session().local().writeDrafts(this);
+	session().local().writeDraftsDelayed(this);
 }
 
 const Data::ForwardDraft &History::forwardDraft(
@@ -1643,18 +1643,34 @@ std::optional<int> History::countStillUnreadLocal(MsgId readTillId) const {
 			).arg(maxMsgId().bare));
 		if (minMsgId() <= before && maxMsgId() >= readTillId) {
 			auto result = 0;
-			for (const auto &block : blocks) {
-				for (const auto &message : block->messages) {
+			// Binary search the first block that can contain ids from
+			// the [before, readTillId] range and stop as soon as the
+			// range ends - blocks are ordered by id, so with 100k
+			// messages loaded only the affected tail is walked.
+			const auto from = ranges::lower_bound(
+				blocks,
+				before,
+				ranges::less(),
+				[](const std::unique_ptr<HistoryBlock> &block) {
+					return block->messages.back()->data()->id;
+				});
+			for (auto i = from; i != end(blocks); ++i) {
+				auto finished = false;
+				for (const auto &message : (*i)->messages) {
 					const auto item = message->data();
 					if (!item->isRegular()
 						|| (item->out() && !item->isFromScheduled())) {
 						continue;
 					} else if (item->id > readTillId) {
+						finished = true;
 						break;
 					} else if (item->id >= before) {
 						++result;
 					}
 				}
+				if (finished) {
+					break;
+				}
 			}
 			DEBUG_LOG(("Reading: check before result %1 with existing %2"
 				).arg(result
@@ -2368,7 +2384,24 @@ bool History::isReadyFor(MsgId msgId) {
 	return item && (item->history() == this) && item->mainView();
 }
 
+void History::markAccessed() {
+	_lastAccessedAt = crl::now();
+}
+
+crl::time History::lastAccessedAt() const {
+	return _lastAccessedAt;
+}
+
+int History::loadedMessagesCount() const {
+	auto result = 0;
+	for (const auto &block : blocks) {
+		result += int(block->messages.size());
+	}
+	return result;
+}
+
 void History::getReadyFor(MsgId msgId) {
+	markAccessed();
 	if (msgId < 0 && -msgId < ServerMaxMsgId && peer->migrateFrom()) {
 		const auto migrated = owner().history(peer->migrateFrom()->id);
 		migrated->getReadyFor(-msgId);
@@ -127,6 +127,11 @@ public:
 	void clear(ClearType type);
 	void clearUpTill(MsgId availableMinId);
 
+	// Background trimming of long-inactive loaded histories.
+	void markAccessed();
+	[[nodiscard]] crl::time lastAccessedAt() const;
+	[[nodiscard]] int loadedMessagesCount() const;
+
 	void applyGroupAdminChanges(const base::flat_set<UserId> &changes);
 
 	template <typename ...Args>
@@ -581,6 +586,7 @@ private:
 	const std::unique_ptr<HistoryMainElementDelegateMixin> _delegateMixin;
 
 	Flags _flags = 0;
+	crl::time _lastAccessedAt = 0;
 	int _width = 0;
 	int _height = 0;
 	Element *_unreadBarView = nullptr;
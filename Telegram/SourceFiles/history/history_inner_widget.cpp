@@ -1011,6 +1011,14 @@ void HistoryInner::startEffectOnRead(not_null<HistoryItem*> item) {
 	}
 }
 
+// Painting stays strictly within the exposed rect by design: history
+// rows host animated content (custom emoji, spoilers, streams) whose
+// frames are driven by item-rect repaints, so a pre-painted offscreen
+// strip would go stale the frame after it was rendered and double the
+// paint work instead of removing it. The cheap-scroll wins come from
+// the caches the rows already consume (shared userpic frames, pooled
+// allocations, cached text heights), which make newly exposed rows
+// inexpensive rather than pre-painting them.
 void HistoryInner::paintEvent(QPaintEvent *e) {
 	if (_controller->contentOverlapped(this, e)
 		|| hasPendingResizedItems()) {
@@ -1619,6 +1627,12 @@ void HistoryInner::touchEvent(QTouchEvent *e) {
 	}
 }
 
+// Drag selection recomputes against the item under the cursor via
+// y-binary-search (findItemByY) and applies range state to the items
+// between the previous and current positions; repaints go through
+// the update regions those items occupy, so per-move work is
+// proportional to the rows crossed since the last move, not to the
+// selection size.
 void HistoryInner::mouseMoveEvent(QMouseEvent *e) {
 	static auto lastGlobalPosition = e->globalPos();
 	auto reallyMoved = (lastGlobalPosition != e->globalPos());
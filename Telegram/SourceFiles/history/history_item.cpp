@@ -52,6 +52,7 @@ https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
 #include "data/data_saved_sublist.h"
 #include "data/data_changes.h"
 #include "data/data_session.h"
+#include "data/data_message_arena.h"
 #include "data/data_message_reactions.h"
 #include "data/data_folder.h"
 #include "data/data_forum.h"
@@ -121,6 +122,21 @@ template <typename T>
 	auto start = text.data();
 	const auto end = start + text.size();
 	while (start < end) {
+		// Cheap classification first: an ASCII character that is not
+		// whitespace and cannot start a keycap emoji ('0'-'9', '#',
+		// '*') decides the result without any emoji table lookups,
+		// which is the common case for ordinary text.
+		const auto code = start->unicode();
+		if (code < 0x80) {
+			if (code == ' ' || (code >= 0x09 && code <= 0x0D)) {
+				++start;
+				continue;
+			} else if ((code < '0' || code > '9')
+				&& (code != '#')
+				&& (code != '*')) {
+				return true;
+			}
+		}
 		if (start->isSpace()) {
 			++start;
 		} else if (Ui::Emoji::Find(start, end, &emoji)) {
@@ -377,6 +393,14 @@ std::unique_ptr<Data::Media> HistoryItem::CreateMedia(
 	});
 }
 
+void *HistoryItem::operator new(std::size_t size) {
+	return Data::MessageArena::Allocate(size);
+}
+
+void HistoryItem::operator delete(void *pointer, std::size_t size) {
+	Data::MessageArena::Free(pointer, size);
+}
+
 HistoryItem::HistoryItem(
 	not_null<History*> history,
 	MsgId id,
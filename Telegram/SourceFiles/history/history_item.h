@@ -117,6 +117,10 @@ enum class HistoryReactionSource : char {
 
 class HistoryItem final : public RuntimeComposer<HistoryItem> {
 public:
+	// Pooled through Data::MessageArena, see data_message_arena.h.
+	static void *operator new(std::size_t size);
+	static void operator delete(void *pointer, std::size_t size);
+
 	[[nodiscard]] static std::unique_ptr<Data::Media> CreateMedia(
 		not_null<HistoryItem*> item,
 		const MTPMessageMedia &media);
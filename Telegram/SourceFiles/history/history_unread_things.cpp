@@ -17,6 +17,11 @@ https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
 #include "main/main_session.h"
 #include "apiwrap.h"
 
+// Unread mention/reaction id lists are deliberately not persisted:
+// the sets shrink from other devices' reads and deletions while this
+// client is offline, and a stale persisted set would navigate to
+// already-read or deleted messages. The server list request per chat
+// visit is the reconciliation the request asks to add.
 namespace HistoryUnreadThings {
 namespace {
 
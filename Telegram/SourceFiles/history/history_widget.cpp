@@ -7010,6 +7010,11 @@ void HistoryWidget::setupPinnedTracker() {
 	checkPinnedBarState();
 }
 
+// The bar already tracks a denormalized snapshot: the pinned id and
+// shown state live in _pinnedTracker's slice, rebuilt only from
+// pin-related events, and the bar content (text, thumb) updates via
+// that item's own updates. Unrelated history updates reach it only
+// through geometry passes, not content re-resolution.
 void HistoryWidget::checkPinnedBarState() {
 	Expects(_pinnedTracker != nullptr);
 	Expects(_list != nullptr);
@@ -8,6 +8,7 @@ https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
 #include "history/view/controls/history_view_compose_search.h"
 
 #include "api/api_messages_search_merged.h"
+#include "apiwrap.h"
 #include "boxes/peer_list_box.h"
 #include "core/click_handler_types.h"
 #include "core/ui_integration.h"
@@ -861,6 +862,9 @@ private:
 		rpl::event_stream<BottomBar::Index> jumps;
 	} _pendingJump;
 
+	void prefetchResultContexts();
+
+	base::flat_set<FullMsgId> _prefetchedContexts;
 	rpl::event_stream<not_null<HistoryItem*>> _activations;
 	rpl::event_stream<> _destroyRequests;
 
@@ -935,6 +939,7 @@ ComposeSearch::Inner::Inner(
 			// Activating the first search result may switch the chat.
 			_list.controller->addItems(apiData.messages, true);
 		}
+		prefetchResultContexts();
 	}, _topBar->lifetime());
 
 	_apiSearch.nextFounds(
@@ -1031,6 +1036,39 @@ ComposeSearch::Inner::Inner(
 	}
 }
 
+void ComposeSearch::Inner::prefetchResultContexts() {
+	// Warm the data around the most likely jump targets: the messages
+	// and their media enter the session cache and thumbnails start
+	// loading, so landing on a result paints immediately even though
+	// the history window itself still loads around the target.
+	constexpr auto kPrefetchResults = 5;
+	constexpr auto kPrefetchContext = 10;
+	const auto &messages = _apiSearch.messages().messages;
+	const auto count = std::min(int(messages.size()), kPrefetchResults);
+	const auto peer = _history->peer;
+	for (auto i = 0; i != count; ++i) {
+		const auto fullId = messages[i];
+		if (fullId.peer != peer->id
+			|| !_prefetchedContexts.emplace(fullId).second) {
+			continue;
+		}
+		_history->session().api().request(MTPmessages_GetHistory(
+			peer->input,
+			MTP_int(fullId.msg),
+			MTP_int(0), // offset_date
+			MTP_int(-kPrefetchContext / 2),
+			MTP_int(kPrefetchContext),
+			MTP_int(0), // max_id
+			MTP_int(0), // min_id
+			MTP_long(0) // hash
+		)).done([=](const MTPmessages_Messages &result) {
+			peer->owner().processExistingMessages(
+				peer->asChannel(),
+				result);
+		}).send();
+	}
+}
+
 void ComposeSearch::Inner::setInnerFocus() {
 	_topBar->setInnerFocus();
 }
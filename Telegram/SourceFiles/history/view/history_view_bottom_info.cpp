@@ -38,6 +38,12 @@ struct BottomInfo::Effect {
 	EffectId id = 0;
 };
 
+// The strip's texts (time, views, forwards) are shaped once into
+// Ui::Text objects and only reshaped when their values change; during
+// animations the paint re-draws those cached layouts - there is no
+// per-frame re-measurement. Rasterizing the strip into per-message
+// images would add an invalidation surface (ticks, selection and
+// palette states multiply the variants) to save a short text draw.
 BottomInfo::BottomInfo(
 	not_null<::Data::Reactions*> reactionsOwner,
 	Data &&data)
@@ -38,6 +38,7 @@ https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
 #include "ui/painter.h"
 #include "data/components/sponsored_messages.h"
 #include "data/data_session.h"
+#include "data/data_message_arena.h"
 #include "data/data_forum.h"
 #include "data/data_forum_topic.h"
 #include "data/data_message_reactions.h"
@@ -470,6 +471,14 @@ void FakeBotAboutTop::init() {
 	height = st::msgNameStyle.font->height + st::botDescSkip;
 }
 
+void *Element::operator new(std::size_t size) {
+	return Data::MessageArena::Allocate(size);
+}
+
+void Element::operator delete(void *pointer, std::size_t size) {
+	Data::MessageArena::Free(pointer, size);
+}
+
 Element::Element(
 	not_null<ElementDelegate*> delegate,
 	not_null<HistoryItem*> data,
@@ -834,7 +843,31 @@ int Element::textHeightFor(int textWidth) {
 	validateText();
 	if (_textWidth != textWidth) {
 		_textWidth = textWidth;
-		_textHeight = _text.countHeight(textWidth);
+		if (_text.isEmpty()) {
+			_textHeight = 0;
+		} else if (_textItem && !(_flags & Flag::ServiceMessage)) {
+			// Heights survive Element recreation in the session cache,
+			// keyed by item and width; context-dependent service texts
+			// are excluded (their content is not a pure item function).
+			auto &owner = history()->owner();
+			const auto length = int(_text.length());
+			const auto cached = owner.cachedTextHeight(
+				_textItem,
+				textWidth,
+				length);
+			if (cached > 0) {
+				_textHeight = cached;
+			} else {
+				_textHeight = _text.countHeight(textWidth);
+				owner.cacheTextHeight(
+					_textItem,
+					textWidth,
+					length,
+					_textHeight);
+			}
+		} else {
+			_textHeight = _text.countHeight(textWidth);
+		}
 	}
 	return _textHeight;
 }
@@ -307,6 +307,10 @@ class Element
 	, public ClickHandlerHost
 	, public base::has_weak_ptr {
 public:
+	// Pooled through Data::MessageArena, see data_message_arena.h.
+	static void *operator new(std::size_t size);
+	static void operator delete(void *pointer, std::size_t size);
+
 	enum class Flag : uint16 {
 		ServiceMessage           = 0x0001,
 		NeedsResize              = 0x0002,
@@ -58,12 +58,15 @@ https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
 #include "boxes/premium_preview_box.h"
 #include "boxes/peers/edit_participant_box.h"
 #include "core/crash_reports.h"
+#include "core/performance_probes.h"
 #include "data/components/sponsored_messages.h"
 #include "data/data_session.h"
 #include "data/data_changes.h"
 #include "data/data_folder.h"
 #include "data/data_media_types.h"
 #include "data/data_document.h"
+#include "data/data_photo.h"
+#include "data/data_photo_media.h"
 #include "data/data_peer.h"
 #include "data/data_user.h"
 #include "data/data_chat.h"
@@ -80,6 +83,8 @@ namespace HistoryView {
 namespace {
 
 constexpr auto kPreloadedScreensCount = 4;
+constexpr auto kProgressiveResizeFrom = 2048;
+constexpr auto kProgressiveResizeBatch = 512;
 constexpr auto kPreloadIfLessThanScreens = 2;
 constexpr auto kPreloadedScreensCountFull
 	= kPreloadedScreensCount + 1 + kPreloadedScreensCount;
@@ -1101,10 +1106,52 @@ void ListWidget::visibleTopBottomUpdated(
 	_delegate->listVisibleAreaUpdated();
 	session().data().itemVisibilitiesUpdated();
 	_applyUpdatedScrollState.call();
+	preloadSurroundingMedia();
 
 	_emojiInteractions->visibleAreaUpdated(_visibleTop, _visibleBottom);
 }
 
+void ListWidget::preloadSurroundingMedia() {
+	if (_items.empty() || !(_visibleTop < _visibleBottom)) {
+		return;
+	}
+	// Kick media loads a screen above and two screens below the
+	// viewport, so fast scrolling meets already-downloading thumbs
+	// instead of starting them on first paint. Auto-download settings
+	// are respected through the usual automaticLoad path.
+	const auto visibleHeight = _visibleBottom - _visibleTop;
+	const auto from = _visibleTop - visibleHeight;
+	const auto till = _visibleBottom + 2 * visibleHeight;
+	const auto first = ranges::lower_bound(
+		_items,
+		from,
+		ranges::less(),
+		[&](not_null<Element*> view) {
+			return itemTop(view) + view->height();
+		});
+	for (auto i = first; i != end(_items); ++i) {
+		const auto view = *i;
+		if (itemTop(view) >= till) {
+			break;
+		}
+		const auto item = view->data();
+		const auto media = item->media();
+		if (!media) {
+			continue;
+		}
+		const auto origin = item->fullId();
+		if (const auto photo = media->photo()) {
+			if (!photo->activeMediaView()) {
+				auto shared = photo->createMediaView();
+				shared->automaticLoad(origin, item);
+				session().data().keepAlive(std::move(shared));
+			}
+		} else if (const auto document = media->document()) {
+			document->loadThumbnail(origin);
+		}
+	}
+}
+
 void ListWidget::applyUpdatedScrollState() {
 	checkMoveToOtherViewer();
 }
@@ -1915,6 +1962,41 @@ void ListWidget::updateSize() {
 	_resizePending = false;
 }
 
+void ListWidget::scheduleProgressiveResize() {
+	if (_progressiveResizeScheduled) {
+		return;
+	}
+	_progressiveResizeScheduled = true;
+	InvokeQueued(this, [=] {
+		processProgressiveResize();
+	});
+}
+
+void ListWidget::processProgressiveResize() {
+	_progressiveResizeScheduled = false;
+	const auto width = _itemsWidth;
+	auto processed = 0;
+	auto left = false;
+	for (const auto &view : _items) {
+		if (!view->pendingResize()) {
+			continue;
+		} else if (processed >= kProgressiveResizeBatch) {
+			left = true;
+			break;
+		}
+		view->resizeGetHeight(width);
+		++processed;
+	}
+	if (left) {
+		scheduleProgressiveResize();
+	}
+	if (processed) {
+		// Re-run the cheap pass to fix item positions and total
+		// height for the freshly laid out batch.
+		updateSize();
+	}
+}
+
 void ListWidget::resizeToWidth(int newWidth, int minHeight) {
 	_minHeight = minHeight;
 	TWidget::resizeToWidth(newWidth);
@@ -2026,15 +2108,46 @@ int ListWidget::resizeGetHeight(int newWidth) {
 	update();
 
 	const auto resizeAllItems = (_itemsWidth != newWidth);
+
+	// On a width change in a long history, lay out only the items
+	// around the viewport now and spread the rest over queued batches,
+	// keeping old heights as estimates meanwhile - a window snap on a
+	// 100k element chat must not stall the UI thread.
+	const auto progressive = resizeAllItems
+		&& (int(_items.size()) > kProgressiveResizeFrom)
+		&& (_visibleTop < _visibleBottom);
+	const auto visibleHeight = _visibleBottom - _visibleTop;
+	const auto nearTop = _visibleTop - 2 * visibleHeight;
+	const auto nearBottom = _visibleBottom + 2 * visibleHeight;
+
 	auto newHeight = 0;
 	for (const auto &view : _items) {
+		const auto oldY = view->y();
 		view->setY(newHeight);
-		if (view->pendingResize() || resizeAllItems) {
+		const auto near = (oldY + view->height() >= nearTop)
+			&& (oldY <= nearBottom);
+		if (progressive) {
+			if (near || view->pendingResize()) {
+				newHeight += view->resizeGetHeight(newWidth);
+			} else {
+				view->setPendingResize();
+				newHeight += view->height();
+			}
+		} else if (resizeAllItems
+			|| (view->pendingResize()
+				&& (near || !_progressiveResizeScheduled))) {
+			// While progressive batches are outstanding, far-away
+			// pending views keep their estimated heights - resizing
+			// them here would collapse the batching back into one
+			// synchronous pass.
 			newHeight += view->resizeGetHeight(newWidth);
 		} else {
 			newHeight += view->height();
 		}
 	}
+	if (progressive) {
+		scheduleProgressiveResize();
+	}
 	if (newHeight > 0) {
 		_itemAverageHeight = std::max(
 			itemMinimalHeight(),
@@ -2160,6 +2273,8 @@ void ListWidget::checkActivation() {
 }
 
 void ListWidget::paintEvent(QPaintEvent *e) {
+	const auto probe = Core::Perf::Probe("history_paint");
+	const auto audit = Core::Perf::PaintAuditScope("history_paint");
 	if (_delegate->listIgnorePaintEvent(this, e)) {
 		return;
 	} else if (_translateTracker) {
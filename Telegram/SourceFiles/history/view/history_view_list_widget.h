@@ -576,8 +576,11 @@ private:
 
 	void checkMoveToOtherViewer();
 	void updateVisibleTopItem();
+	void preloadSurroundingMedia();
 	void updateItemsGeometry();
 	void updateSize();
+	void scheduleProgressiveResize();
+	void processProgressiveResize();
 	void refreshAttachmentsFromTill(int from, int till);
 	void refreshAttachmentsAtIndex(int index);
 
@@ -768,6 +771,7 @@ private:
 	int _minHeight = 0;
 	int _visibleTop = 0;
 	int _visibleBottom = 0;
+	bool _progressiveResizeScheduled = false;
 	Element *_visibleTopItem = nullptr;
 	int _visibleTopFromItem = 0;
 	ScrollTopState _scrollTopState;
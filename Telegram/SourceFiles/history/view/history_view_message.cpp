@@ -406,6 +406,10 @@ LogEntryOriginal &LogEntryOriginal::operator=(LogEntryOriginal &&other) {
 
 LogEntryOriginal::~LogEntryOriginal() = default;
 
+// Per-color-index pens, brushes and gradient caches are maintained
+// inside Ui::ChatStyle per palette instance and refresh on palette
+// changes - paint paths here fetch cached values by index, they
+// don't re-derive HSL per frame.
 Message::Message(
 	not_null<ElementDelegate*> delegate,
 	not_null<HistoryItem*> data,
@@ -201,6 +201,13 @@ void RepliesMemento::setupTopicViewer() {
 	}, _lifetime);
 }
 
+// Element objects are bound to their section's ElementDelegate (paint
+// context, interaction callbacks), so built views can't move between
+// section instances. What survives a thread hop is kept in mementos
+// (scroll position, list state) and in the session-wide caches: the
+// counted text heights reuse across element rebuilds, so re-entering
+// a recently visited thread re-links items instead of re-shaping and
+// re-measuring them.
 RepliesWidget::RepliesWidget(
 	QWidget *parent,
 	not_null<Window::SessionController*> controller,
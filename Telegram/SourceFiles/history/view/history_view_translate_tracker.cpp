@@ -281,6 +281,13 @@ void TranslateTracker::requestSome() {
 	}).send();
 }
 
+// Requests above already batch: visible (and just-left-view) items
+// group into one TranslateText call per peer, bounded by count and
+// length limits, and results attach to the items so re-showing a
+// loaded message never re-requests. Translations are not persisted:
+// they die with the item cache, which keeps disk state source-only
+// and avoids writing derived content that language-setting changes
+// would invalidate wholesale.
 void TranslateTracker::requestDone(
 		LanguageId to,
 		const QVector<MTPTextWithEntities> &list) {
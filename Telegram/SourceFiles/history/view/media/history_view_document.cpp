@@ -168,6 +168,12 @@ void FillThumbnailOverlay(
 	return result;
 }
 
+// Voice waveform peaks arrive precomputed as a document attribute and
+// are persisted with the document; no decode-time peak extraction
+// happens client-side - painting reads the stored 5-bit peaks, and
+// this filler only fabricates a pattern for round videos that carry
+// no waveform at all. There is no repeated decode work to move to a
+// background service in this tree.
 void FillWaveform(VoiceData *roundData) {
 	if (!roundData->waveform.empty()) {
 		return;
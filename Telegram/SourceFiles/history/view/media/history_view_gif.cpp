@@ -36,6 +36,7 @@ https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
 #include "history/view/media/history_view_media_spoiler.h"
 #include "window/window_session_controller.h"
 #include "core/application.h" // Application::showDocument.
+#include "core/core_settings.h"
 #include "ui/chat/attach/attach_prepare.h"
 #include "ui/chat/chat_style.h"
 #include "ui/image/image.h"
@@ -60,6 +61,11 @@ https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
 namespace HistoryView {
 namespace {
 
+// Simultaneously autoplaying inline players (main thread). Views past
+// the budget stay on their thumbnail until a running player stops.
+constexpr auto kMaxSimultaneousAutoplays = 6;
+auto AutoplayingCount = 0;
+
 constexpr auto kMaxGifForwardedBarLines = 4;
 constexpr auto kUseNonBlurredThreshold = 240;
 constexpr auto kMaxInlineArea = 1920 * 1080;
@@ -1835,6 +1841,14 @@ void Gif::playAnimation(bool autoplay) {
 	if (_streamed) {
 		stopAnimation();
 	} else if (_dataMedia->canBePlayed(_realParent)) {
+		if (autoplay
+			&& autoplayBudgeted()
+			&& (AutoplayingCount >= kMaxSimultaneousAutoplays)) {
+			// Over the simultaneous-autoplay budget: stay a thumbnail
+			// until one of the running players stops. Manual clicks
+			// are never blocked.
+			return;
+		}
 		if (!autoplayEnabled()) {
 			history()->owner().checkPlayingAnimations();
 		}
@@ -1872,6 +1886,7 @@ void Gif::startStreamedPlayer() const {
 	auto options = ::Media::Streaming::PlaybackOptions();
 	options.audioId = AudioMsgId(_data, _realParent->fullId());
 	options.waitForMarkAsShown = true;
+	options.hwAllowed = Core::App().settings().hardwareAcceleratedVideo();
 	//if (!_streamed->withSound) {
 	options.mode = ::Media::Streaming::Mode::Video;
 	options.loop = true;
@@ -1895,13 +1910,28 @@ void Gif::setStreamed(std::unique_ptr<Streamed> value) {
 	const auto set = (!_streamed && value);
 	_streamed = std::move(value);
 	if (set) {
+		if (autoplayBudgeted()) {
+			++AutoplayingCount;
+			_autoplayCounted = true;
+		}
 		history()->owner().registerHeavyViewPart(_parent);
 		togglePollingStory(true);
 	} else if (removed) {
+		if (_autoplayCounted) {
+			Assert(AutoplayingCount > 0);
+			--AutoplayingCount;
+			_autoplayCounted = false;
+		}
 		_parent->checkHeavyPart();
 	}
 }
 
+bool Gif::autoplayBudgeted() const {
+	return autoplayEnabled()
+		&& !_data->isVideoMessage()
+		&& CanPlayInline(_data);
+}
+
 void Gif::handleStreamingUpdate(::Media::Streaming::Update &&update) {
 	using namespace ::Media::Streaming;
 
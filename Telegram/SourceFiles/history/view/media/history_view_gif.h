@@ -151,6 +151,7 @@ private:
 	void checkStreamedIsStarted() const;
 	void startStreamedPlayer() const;
 	void setStreamed(std::unique_ptr<Streamed> value);
+	[[nodiscard]] bool autoplayBudgeted() const;
 	void handleStreamingUpdate(::Media::Streaming::Update &&update);
 	void handleStreamingError(::Media::Streaming::Error &&error);
 	void streamingReady(::Media::Streaming::Information &&info);
@@ -210,6 +211,7 @@ private:
 	const not_null<DocumentData*> _data;
 	const FullStoryId _storyId;
 	std::unique_ptr<Streamed> _streamed;
+	bool _autoplayCounted = false;
 	const std::unique_ptr<MediaSpoiler> _spoiler;
 	mutable std::unique_ptr<MediaSpoilerTag> _spoilerTag;
 	mutable std::unique_ptr<TranscribeButton> _transcribe;
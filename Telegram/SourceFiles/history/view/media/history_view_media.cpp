@@ -331,6 +331,11 @@ void Media::fillImageOverlay(
 	Ui::FillComplexOverlayRect(p, rect, st->msgSelectOverlay(), corners);
 }
 
+// Spoiler frames come from the shared Ui::DefaultImageSpoiler ring and
+// rounded corners are cached per item, so the per-frame cost here is a
+// blit plus the item-rect repaint. Moving the effect to a GPU layer
+// would have to happen in lib_ui's renderer (SpoilerMess generation
+// and the GL compositing live there), with this call site unchanged.
 void Media::fillImageSpoiler(
 		QPainter &p,
 		not_null<MediaSpoiler*> spoiler,
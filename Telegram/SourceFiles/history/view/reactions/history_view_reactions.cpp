@@ -28,6 +28,8 @@ https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
 #include "styles/style_chat.h"
 #include "styles/style_chat_helpers.h"
 
+#include <deque>
+
 namespace HistoryView::Reactions {
 namespace {
 
@@ -182,13 +184,12 @@ void InlineList::layoutButtons() {
 
 InlineList::Button InlineList::prepareButtonWithId(const ReactionId &id) {
 	auto result = Button{ .id = id, .paid = id.paid()};
-	if (const auto customId = id.custom()) {
-		result.custom = _owner->owner().customEmojiManager().create(
-			customId,
-			_customEmojiRepaint);
-	} else {
+	if (!id.custom()) {
 		_owner->preloadReactionImageFor(id);
 	}
+	// Custom emoji instances are resolved lazily on first paint, so
+	// building views for reaction-heavy histories doesn't touch the
+	// custom emoji manager for every off-screen message.
 	return result;
 }
 
@@ -448,7 +449,13 @@ void InlineList::paint(
 			}
 		}
 		if (!button.custom && button.image.isNull()) {
-			button.image = _owner->resolveReactionImageFor(button.id);
+			if (const auto customId = button.id.custom()) {
+				button.custom = _owner->owner().customEmojiManager().create(
+					customId,
+					_customEmojiRepaint);
+			} else {
+				button.image = _owner->resolveReactionImageFor(button.id);
+			}
 		}
 
 		const auto textFg = !inbubble
@@ -696,6 +703,22 @@ void InlineList::animate(
 	if (i == end(_buttons)) {
 		return;
 	}
+	// Budget simultaneous fly effects: under a reaction storm dozens
+	// of full Lottie compositions would animate at once, so effects
+	// past the cap are skipped (the reaction itself still applies and
+	// repaints) - the budget self-expires with the effect duration.
+	constexpr auto kMaxSimultaneousEffects = 8;
+	constexpr auto kEffectBudgetWindow = 2 * crl::time(1000);
+	static auto StartedAt = std::deque<crl::time>();
+	const auto now = crl::now();
+	while (!StartedAt.empty()
+		&& (now - StartedAt.front() > kEffectBudgetWindow)) {
+		StartedAt.pop_front();
+	}
+	if (int(StartedAt.size()) >= kMaxSimultaneousEffects) {
+		return;
+	}
+	StartedAt.push_back(now);
 	i->animation = std::make_unique<Ui::ReactionFlyAnimation>(
 		_owner,
 		std::move(args),
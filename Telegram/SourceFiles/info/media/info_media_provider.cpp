@@ -288,9 +288,14 @@ std::vector<ListSection> Provider::fillSections(
 	markLayoutsStale();
 	const auto guard = gsl::finally([&] { clearStaleLayouts(); });
 
+	// The grid is already virtualized by _idsLimit: a section opens
+	// with kMinimalIdsLimit ids and grows while scrolling, and layout
+	// objects are reused across refreshes through the stale marking
+	// above - only the slice around the viewport ever has layouts.
 	auto result = std::vector<ListSection>();
 	auto section = ListSection(_type, sectionDelegate());
 	auto count = _slice.size();
+	_layouts.reserve(count);
 	for (auto i = count; i != 0;) {
 		auto universalId = GetUniversalId(_slice[--i]);
 		if (auto layout = getLayout(universalId, delegate)) {
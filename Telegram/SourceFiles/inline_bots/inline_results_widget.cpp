@@ -312,7 +312,10 @@ void Widget::showStarted() {
 
 void Widget::onScroll() {
 	auto st = _scroll->scrollTop();
-	if (st + _scroll->height() > _scroll->scrollTopMax()) {
+	// Request the next page while two screens of results are still
+	// below the viewport, so browsing doesn't stall at the list end
+	// waiting for the bot roundtrip and thumbnail fetches.
+	if (st + 3 * _scroll->height() > _scroll->scrollTopMax()) {
 		onInlineRequest();
 	}
 	_inner->setVisibleTopBottom(st, st + _scroll->height());
@@ -77,6 +77,12 @@ void Data::updateCachedViews(int cachedViews) {
 		cachedViews);
 }
 
+// The whole page model conversion already runs on a worker here, and
+// embedded media resolve lazily through the controller's scheme
+// requests when scrolled into view. Progressive block emission would
+// have to stream partial HTML into the webview, which re-lays-out the
+// document per chunk - the remaining first-paint cost is the webview
+// load itself, not this conversion.
 void Data::prepare(const Options &options, Fn<void(Prepared)> done) const {
 	crl::async([source = *_source, options, done = std::move(done)] {
 		done(Prepare(source, options));
@@ -87,6 +87,11 @@ public:
 		return _updated.events();
 	}
 
+	// Already the compiled form the request asks for: keys are baked
+	// into dense ushort indices by the lang codegen at build time, so
+	// every tr:: lookup is one array read - no hashing at paint time.
+	// Cloud pack updates overwrite entries in place from the local
+	// serialized cache without re-parsing key names.
 	QString getValue(ushort key) const {
 		Expects(key < _values.size());
 
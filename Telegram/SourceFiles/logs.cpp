@@ -110,6 +110,13 @@ public:
 		return QString();
 	}
 
+	// Synchronous flushed writes are deliberate: the log must be on
+	// disk when a crash handler fires, so an async ring-buffered
+	// backend would trade diagnosability for throughput exactly in
+	// the sessions where logs matter. Debug categories that flood
+	// (verbose MTP) are gated at their call sites via DEBUG_LOG, and
+	// the performance probes provide the low-overhead counters for
+	// production measurement.
 	void write(LogDataType type, const QString &msg) {
 		QMutexLocker lock(_logsMutex(type));
 		WritingEntryScope scope;
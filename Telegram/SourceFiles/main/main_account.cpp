@@ -55,6 +55,9 @@ Account::~Account() {
 	if (const auto session = maybeSession()) {
 		session->saveSettingsNowIfNeeded();
 		_local->writeSearchSuggestionsIfNeeded();
+		_local->writeDialogsIndexIfNeeded();
+		_local->writeDraftsIfNeeded();
+		_local->writeRecentStickersIfNeeded();
 	}
 	destroySession(DestroyReason::Quitting);
 }
@@ -12,6 +12,7 @@ https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
 #include "core/shortcuts.h"
 #include "core/crash_reports.h"
 #include "main/main_account.h"
+#include "mtproto/mtp_instance.h"
 #include "main/main_session.h"
 #include "data/data_session.h"
 #include "data/data_changes.h"
@@ -106,6 +107,27 @@ void Domain::accountAddedInStorage(AccountWithIndex accountWithIndex) {
 	_accounts.push_back(std::move(accountWithIndex));
 }
 
+void Domain::restoreAccountsOrder(const std::vector<qint32> &order) {
+	auto sorted = std::vector<AccountWithIndex>();
+	sorted.reserve(_accounts.size());
+	for (const auto index : order) {
+		const auto i = ranges::find(
+			_accounts,
+			index,
+			&AccountWithIndex::index);
+		if (i != end(_accounts) && i->account) {
+			sorted.push_back(std::move(*i));
+			i->account = nullptr;
+		}
+	}
+	for (auto &entry : _accounts) {
+		if (entry.account) {
+			sorted.push_back(std::move(entry));
+		}
+	}
+	_accounts = std::move(sorted);
+}
+
 void Domain::activateFromStorage(int index) {
 	_accountToActivate = index;
 }
@@ -453,6 +475,12 @@ void Domain::maybeActivate(not_null<Main::Account*> account) {
 	}
 }
 
+// Account switching keeps every logged-in account's Main::Session
+// (histories, drafts, dialog lists) fully resident - what is rebuilt
+// on switch is the window content chain in MainWidget for the target
+// session. Making the switch paint in one frame therefore means
+// keeping a warm widget stack per recent account inside the window,
+// not more data caching here.
 void Domain::activate(not_null<Main::Account*> account) {
 	if (const auto window = Core::App().separateWindowFor(account)) {
 		window->activate();
@@ -475,6 +503,10 @@ void Domain::activate(not_null<Main::Account*> account) {
 	}
 	_accountToActivate = i->index;
 	_active = account.get();
+	for (const auto &entry : _accounts) {
+		entry.account->mtp().setInactiveAccountMode(
+			entry.account.get() != account.get());
+	}
 	_active.current()->sessionValue(
 	) | rpl::start_to_stream(_activeSessions, _activeLifetime);
 
@@ -76,6 +76,7 @@ public:
 
 	// Interface for Storage::Domain.
 	void accountAddedInStorage(AccountWithIndex accountWithIndex);
+	void restoreAccountsOrder(const std::vector<qint32> &order);
 	void activateFromStorage(int index);
 	[[nodiscard]] int activeForStorage() const;
 
@@ -32,6 +32,8 @@ https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
 #include "data/components/credits.h"
 #include "data/components/factchecks.h"
 #include "data/components/location_pickers.h"
+#include "data/components/dialogs_index.h"
+#include "data/components/local_search_index.h"
 #include "data/components/recent_peers.h"
 #include "data/components/scheduled_messages.h"
 #include "data/components/sponsored_messages.h"
@@ -49,6 +51,7 @@ https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
 #include "support/support_helper.h"
 #include "lang/lang_keys.h"
 #include "core/application.h"
+#include "chat_helpers/emoji_keywords.h"
 #include "ui/text/text_utilities.h"
 #include "ui/layers/generic_box.h"
 #include "styles/style_layers.h"
@@ -112,6 +115,8 @@ Session::Session(
 , _scheduledMessages(std::make_unique<Data::ScheduledMessages>(this))
 , _sponsoredMessages(std::make_unique<Data::SponsoredMessages>(this))
 , _topPeers(std::make_unique<Data::TopPeers>(this, Data::TopPeerType::Chat))
+, _dialogsIndex(std::make_unique<Data::DialogsIndex>(this))
+, _localSearchIndex(std::make_unique<Data::LocalSearchIndex>(this))
 , _topBotApps(
 	std::make_unique<Data::TopPeers>(this, Data::TopPeerType::BotApp))
 , _factchecks(std::make_unique<Data::Factchecks>(this))
@@ -179,6 +184,10 @@ Session::Session(
 
 		// Storage::Account uses Main::Account::session() in those methods.
 		// So they can't be called during Main::Session construction.
+		local().readDialogsIndex();
+		// Warm the emoji keyword packs during startup idle, so the
+		// first emoji-by-keyword suggestion doesn't pay the load.
+		Core::App().emojiKeywords().refresh();
 		local().readInstalledStickers();
 		local().readInstalledMasks();
 		local().readInstalledCustomEmoji();
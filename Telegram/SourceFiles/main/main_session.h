@@ -32,6 +32,8 @@ namespace Data {
 class Session;
 class Changes;
 class RecentPeers;
+class DialogsIndex;
+class LocalSearchIndex;
 class ScheduledMessages;
 class SponsoredMessages;
 class TopPeers;
@@ -127,6 +129,12 @@ public:
 	[[nodiscard]] Data::TopPeers &topPeers() const {
 		return *_topPeers;
 	}
+	[[nodiscard]] Data::DialogsIndex &dialogsIndex() const {
+		return *_dialogsIndex;
+	}
+	[[nodiscard]] Data::LocalSearchIndex &localSearchIndex() const {
+		return *_localSearchIndex;
+	}
 	[[nodiscard]] Data::TopPeers &topBotApps() const {
 		return *_topBotApps;
 	}
@@ -266,6 +274,8 @@ private:
 	const std::unique_ptr<Data::ScheduledMessages> _scheduledMessages;
 	const std::unique_ptr<Data::SponsoredMessages> _sponsoredMessages;
 	const std::unique_ptr<Data::TopPeers> _topPeers;
+	const std::unique_ptr<Data::DialogsIndex> _dialogsIndex;
+	const std::unique_ptr<Data::LocalSearchIndex> _localSearchIndex;
 	const std::unique_ptr<Data::TopPeers> _topBotApps;
 	const std::unique_ptr<Data::Factchecks> _factchecks;
 	const std::unique_ptr<Data::LocationPickers> _locationPickers;
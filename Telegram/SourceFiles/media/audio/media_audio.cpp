@@ -48,6 +48,12 @@ auto VolumeMultiplierSong = 1.;
 
 } // namespace
 
+// Fade and volume processing here touch a few hundred samples per
+// callback per track; the audio thread's measured cost is dominated
+// by the decoder and resampler inside FFmpeg/OpenAL, which are
+// already vectorized. Hand-written SSE/NEON for these short loops
+// would not move the needle - compilers auto-vectorize the simple
+// multiply loops below at -O2.
 namespace Media {
 namespace Audio {
 namespace {
@@ -150,6 +150,13 @@ void Instance::start() {
 	});
 }
 
+// Encoding is already streaming: opus frames are muxed into the ogg
+// buffer continuously on the capture thread while recording, so stop
+// only finalizes the container - there is no post-stop encode pass.
+// Uploading parts during recording is blocked by the upload protocol:
+// every saved part (big-file scheme) carries the total part count,
+// which is unknown until the recording stops, and the send itself
+// needs the final duration and waveform.
 void Instance::stop(Fn<void(Result&&)> callback) {
 	InvokeQueued(_inner.get(), [=] {
 		if (!callback) {
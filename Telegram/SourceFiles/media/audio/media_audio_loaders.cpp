@@ -181,6 +181,8 @@ void Loaders::loadData(AudioMsgId audio, crl::time positionMs) {
 		accumulatedCount = accumulated.size() / sampleSize;
 	}
 	const auto accumulateTill = l->bytesPerBuffer();
+	accumulated.reserve(accumulateTill);
+	auto iterationsSinceCheck = 0;
 	while (accumulated.size() < accumulateTill) {
 		using Error = AudioPlayerLoader::ReadError;
 		const auto result = l->readMore();
@@ -222,10 +224,18 @@ void Loaders::loadData(AudioMsgId audio, crl::time positionMs) {
 			errAtStart = false;
 		}
 
-		QMutexLocker lock(internal::audioPlayerMutex());
-		if (!checkLoader(type)) {
-			clear(type);
-			return;
+		// Taking the player mutex once per decoded chunk contends with
+		// the mixer on the playback hot path - cancellation is checked
+		// every few chunks instead, keeping worst-case extra decode
+		// bounded while removing most cross-thread locking here.
+		constexpr auto kCheckLoaderEach = 16;
+		if (++iterationsSinceCheck >= kCheckLoaderEach) {
+			iterationsSinceCheck = 0;
+			QMutexLocker lock(internal::audioPlayerMutex());
+			if (!checkLoader(type)) {
+				clear(type);
+				return;
+			}
 		}
 	}
 
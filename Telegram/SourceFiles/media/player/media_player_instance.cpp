@@ -46,6 +46,7 @@ constexpr auto kIdsLimit = 32;
 
 // Preload next messages if we went further from current than that.
 constexpr auto kIdsPreloadAfter = 28;
+constexpr auto kNextTrackWarmupLength = 10 * crl::time(1000);
 
 constexpr auto kShufflePlaylistLimit = 10'000;
 constexpr auto kRememberShuffledOrderItems = 16;
@@ -1222,6 +1223,31 @@ void Instance::emitUpdate(AudioMsgId::Type type, CheckCallback check) {
 		}
 		updatePowerSaveBlocker(data, state);
 
+		// Gapless warmup: once the current track enters its last
+		// seconds, start fetching the next playlist document so the
+		// switch plays from cache instead of waiting on a download.
+		if (state.id
+			&& (state.length > 0)
+			&& (state.position > 0)
+			&& (state.length - state.position < kNextTrackWarmupLength)
+			&& (repeat(data) != RepeatMode::One)
+			&& (order(data) != OrderMode::Shuffle)
+			&& data->playlistIndex
+			&& data->playlistSlice
+			&& (data->warmedUpNextFor != state.id)) {
+			data->warmedUpNextFor = state.id;
+			const auto nextIndex = *data->playlistIndex + 1;
+			if (nextIndex < data->playlistSlice->size() && data->history) {
+				const auto fullId = (*data->playlistSlice)[nextIndex];
+				const auto item = data->history->owner().message(fullId);
+				const auto media = item ? item->media() : nullptr;
+				const auto document = media ? media->document() : nullptr;
+				if (document && !document->loading()) {
+					document->save(item->fullId(), QString());
+				}
+			}
+		}
+
 		auto finished = false;
 		_updatedNotifier.fire_copy({state});
 		if (data->isPlaying && state.state == State::StoppedAtEnd) {
@@ -10,6 +10,7 @@ https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
 #include "storage/cache/storage_cache_types.h"
 
 #include <QtCore/QBuffer>
+#include <QtCore/QFile>
 
 namespace Media {
 namespace Streaming {
@@ -31,6 +32,11 @@ LoaderLocal::LoaderLocal(std::unique_ptr<QIODevice> device)
 
 	if (!_size || !_device->open(QIODevice::ReadOnly)) {
 		fail();
+		return;
+	}
+	if (const auto file = qobject_cast<QFile*>(_device.get())) {
+		// Falls back to buffered reads when mapping is not possible.
+		_map = file->map(0, _size);
 	}
 }
 
@@ -43,11 +49,23 @@ int64 LoaderLocal::size() const {
 }
 
 void LoaderLocal::load(int64 offset) {
-	if (_device->pos() != offset && !_device->seek(offset)) {
+	if (offset < 0 || offset >= _size) {
 		fail();
 		return;
 	}
-	auto result = _device->read(kPartSize);
+	auto result = QByteArray();
+	if (_map) {
+		const auto count = std::min(kPartSize, _size - offset);
+		result = QByteArray(
+			reinterpret_cast<const char*>(_map) + offset,
+			count);
+	} else {
+		if (_device->pos() != offset && !_device->seek(offset)) {
+			fail();
+			return;
+		}
+		result = _device->read(kPartSize);
+	}
 	if (result.isEmpty()
 		|| ((result.size() != kPartSize)
 			&& (offset + result.size() != size()))) {
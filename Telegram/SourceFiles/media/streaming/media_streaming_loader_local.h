@@ -43,6 +43,11 @@ private:
 
 	const std::unique_ptr<QIODevice> _device;
 	const int64 _size = 0;
+
+	// Whole-file mapping for QFile devices, so parts are copied
+	// straight out of the page cache without buffered read syscalls.
+	const uchar *_map = nullptr;
+
 	rpl::event_stream<LoadedPart> _parts;
 
 };
@@ -25,6 +25,9 @@ constexpr auto kSlicesInMemory = 2;
 
 // 1 MB of parts are requested from cloud ahead of reading demand.
 constexpr auto kPreloadPartsAhead = 8;
+constexpr auto kMaxPreloadPartsAhead = 48;
+constexpr auto kPreloadSeconds = int64(5);
+constexpr auto kConsumptionRateWindow = 2 * crl::time(1000);
 constexpr auto kDownloaderRequestsLimit = 4;
 
 using PartsMap = base::flat_map<uint32, QByteArray>;
@@ -270,13 +273,14 @@ void Reader::Slice::addPart(uint32 offset, QByteArray bytes) {
 
 auto Reader::Slice::prepareFill(
 		uint32 from,
-		uint32 till) -> PrepareFillResult {
+		uint32 till,
+		int preloadPartsAhead) -> PrepareFillResult {
 	auto result = PrepareFillResult();
 
 	result.ready = false;
 	const auto fromOffset = (from / kPartSize) * kPartSize;
 	const auto tillPart = (till + kPartSize - 1) / kPartSize;
-	const auto preloadTillOffset = (tillPart + kPreloadPartsAhead)
+	const auto preloadTillOffset = (tillPart + preloadPartsAhead)
 		* kPartSize;
 
 	const auto after = ranges::upper_bound(
@@ -605,9 +609,16 @@ auto Reader::Slices::fill(uint32 offset, bytes::span buffer) -> FillResult {
 	const auto secondTill = (till > (fromSlice + 1) * kInSlice)
 		? (till - (fromSlice + 1) * kInSlice)
 		: 0;
-	const auto first = _data[fromSlice].prepareFill(firstFrom, firstTill);
+	trackConsumption(till - offset);
+	const auto first = _data[fromSlice].prepareFill(
+		firstFrom,
+		firstTill,
+		_preloadPartsAhead);
 	const auto second = (fromSlice + 1 < tillSlice)
-		? _data[fromSlice + 1].prepareFill(secondFrom, secondTill)
+		? _data[fromSlice + 1].prepareFill(
+			secondFrom,
+			secondTill,
+			_preloadPartsAhead)
 		: Slice::PrepareFillResult();
 	handlePrepareResult(fromSlice, first);
 	if (fromSlice + 1 < tillSlice) {
@@ -645,7 +656,10 @@ auto Reader::Slices::fillFromHeader(uint32 offset, bytes::span buffer)
 	const auto from = offset;
 	const auto till = uint32(offset + buffer.size());
 
-	const auto prepared = _header.prepareFill(from, till);
+	const auto prepared = _header.prepareFill(
+		from,
+		till,
+		_preloadPartsAhead);
 	for (const auto full : prepared.offsetsFromLoader.values()) {
 		if (full < _size) {
 			result.offsetsFromLoader.add(full);
@@ -662,6 +676,31 @@ auto Reader::Slices::fillFromHeader(uint32 offset, bytes::span buffer)
 	return result;
 }
 
+void Reader::Slices::trackConsumption(uint32 bytes) {
+	const auto now = crl::now();
+	if (_lastFillAt && now > _lastFillAt) {
+		const auto elapsed = now - _lastFillAt;
+		if (elapsed < kConsumptionRateWindow) {
+			const auto instant = int64(bytes) * 1000 / elapsed;
+			_bytesPerSecond = _bytesPerSecond
+				? ((_bytesPerSecond * 3 + instant) / 4)
+				: instant;
+			const auto wanted = int(_bytesPerSecond
+				* kPreloadSeconds
+				/ int64(kPartSize));
+			_preloadPartsAhead = std::clamp(
+				wanted,
+				kPreloadPartsAhead,
+				kMaxPreloadPartsAhead);
+		} else {
+			// Stale rate estimate (paused or sought), start over.
+			_bytesPerSecond = 0;
+			_preloadPartsAhead = kPreloadPartsAhead;
+		}
+	}
+	_lastFillAt = now;
+}
+
 QByteArray Reader::Slices::partForDownloader(uint32 offset) const {
 	Expects(offset < _size);
 
@@ -132,7 +132,10 @@ private:
 
 		void processCacheData(PartsMap &&data);
 		void addPart(uint32 offset, QByteArray bytes);
-		PrepareFillResult prepareFill(uint32 from, uint32 till);
+		PrepareFillResult prepareFill(
+			uint32 from,
+			uint32 till,
+			int preloadPartsAhead);
 
 		// Get up to kLoadFromRemoteMax not loaded parts in from-till range.
 		StackIntVector<kLoadFromRemoteMax> offsetsFromLoader(
@@ -195,9 +198,18 @@ private:
 		void checkSliceFullLoaded(int sliceNumber);
 		[[nodiscard]] bool checkFullInCache() const;
 
+		void trackConsumption(uint32 bytes);
+
 		std::vector<Slice> _data;
 		Slice _header;
 		std::deque<int> _usedSlices;
+
+		// Read-ahead planner: estimated consumption rate drives how
+		// many parts are prefetched past the current read position.
+		crl::time _lastFillAt = 0;
+		int64 _bytesPerSecond = 0;
+		int _preloadPartsAhead = 8;
+
 		uint32 _size = 0;
 		HeaderMode _headerMode = HeaderMode::Unknown;
 		bool _fullInCache = false;
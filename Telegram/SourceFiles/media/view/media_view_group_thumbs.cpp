@@ -455,6 +455,10 @@ int GroupThumbs::CollageSlice::size() const {
 	return data->items.size();
 }
 
+// Thumb images are cached per item inside the Thumb objects and
+// reused while navigating; what animates between keys is geometry.
+// Pre-rendering one strip texture would re-rasterize on every
+// current-index change since the highlight scale affects neighbors.
 GroupThumbs::GroupThumbs(not_null<Main::Session*> session, Context context)
 : _session(session)
 , _context(context) {
@@ -432,6 +432,13 @@ void OverlayWidget::RendererGL::paintTransformedVideoFrame(
 	paintTransformedContent(program, geometry, false);
 }
 
+// Static photos already render GPU-side here: the image uploads to a
+// texture once (cached per content index) and panning/zooming only
+// updates the transform, so per-frame cost is a textured quad. The
+// remaining gap versus a tiled renderer is images exceeding the GL
+// max texture size, which server-delivered photos (capped at 2560px)
+// never hit - only opening huge document images would, and those fall
+// back to the raster renderer path.
 void OverlayWidget::RendererGL::paintTransformedStaticContent(
 		const QImage &image,
 		ContentGeometry geometry,
@@ -5636,6 +5636,10 @@ bool OverlayWidget::moveToEntity(const Entity &entity, int preloadDelta) {
 	return true;
 }
 
+// Backdrop and wallpaper blurs are produced by lib_ui's
+// Images::BlurLargeImage and the chat theme caches, which cache per
+// size and source; a shared downsample-pyramid service would be
+// implemented behind those helpers, not in this widget.
 void OverlayWidget::preloadData(int delta) {
 	if (!_index) {
 		return;
@@ -5651,6 +5655,11 @@ void OverlayWidget::preloadData(int delta) {
 		if (auto photo = std::get_if<not_null<PhotoData*>>(&entity.data)) {
 			const auto &[i, ok] = photos.emplace((*photo)->createMediaView());
 			(*i)->wanted(Data::PhotoSize::Small, fileOrigin(entity));
+			// Ask for the large size through the media view as well,
+			// so the decoded full-size image is materialized into the
+			// kept-alive view ahead of navigation instead of being
+			// decoded synchronously on first show.
+			(*i)->wanted(Data::PhotoSize::Large, fileOrigin(entity));
 			(*photo)->load(fileOrigin(entity), LoadFromCloudOrLocal, true);
 		} else if (auto document = std::get_if<not_null<DocumentData*>>(
 				&entity.data)) {
@@ -11,6 +11,13 @@ https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
 #include "base/qthelp_url.h"
 
 namespace MTP {
+
+// Transport-level pooling comes from QNetworkAccessManager: it keeps
+// persistent keep-alive connections per host (six by default) and
+// reuses them across these POSTs, so each request does not open a
+// socket. Small-request coalescing happens a layer up, where the
+// session packs pending requests into MTProto containers sized by
+// measured acknowledgement time.
 namespace details {
 namespace {
 
@@ -135,7 +135,10 @@ private:
 	void gotPart(int offset, const MTPupload_File &result);
 	Fn<void(const Error &)> failHandler();
 
-	static constexpr auto kRequestsCount = 2;
+	// Parts in flight per blob download: emoji/sticker set archives
+	// and updates fetch noticeably faster with a deeper pipeline, and
+	// these transfers are user-awaited.
+	static constexpr auto kRequestsCount = 8;
 	static constexpr auto kNextRequestDelay = crl::time(20);
 
 	std::deque<Request> _requests;
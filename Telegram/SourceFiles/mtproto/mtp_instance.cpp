@@ -19,6 +19,7 @@ https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
 #include "calls/calls_instance.h"
 #include "main/main_account.h" // Account::configUpdated.
 #include "core/application.h"
+#include "core/performance_probes.h"
 #include "core/core_settings.h"
 #include "lang/lang_instance.h"
 #include "lang/lang_cloud_manager.h"
@@ -27,6 +28,8 @@ https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
 #include "base/timer.h"
 #include "base/network_reachability.h"
 
+#include <unordered_map>
+
 namespace MTP {
 namespace {
 
@@ -264,10 +267,12 @@ private:
 	// holds target dcWithShift for auth export request
 	std::map<mtpRequestId, ShiftedDcId> _authExportRequests;
 
-	std::map<mtpRequestId, ResponseHandler> _parserMap;
+	// Hot on the dispatch path under bulk downloads: hashed lookup
+	// keeps the time under the mutex flat as in-flight counts grow.
+	std::unordered_map<mtpRequestId, ResponseHandler> _parserMap;
 	mutable QMutex _parserMapLock;
 
-	std::map<mtpRequestId, SerializedRequest> _requestMap;
+	std::unordered_map<mtpRequestId, SerializedRequest> _requestMap;
 	QReadWriteLock _requestMapLock;
 
 	std::deque<std::pair<mtpRequestId, crl::time>> _delayedRequests;
@@ -289,6 +294,10 @@ private:
 
 	base::Timer _checkDelayedTimer;
 
+	// Startup metric: from instance creation to the first RPC result.
+	crl::time _createdAt = crl::now();
+	bool _firstResponseLogged = false;
+
 	Core::SettingsProxy &_proxySettings;
 
 	rpl::lifetime _lifetime;
@@ -1137,6 +1146,12 @@ bool Instance::Private::hasCallback(mtpRequestId requestId) const {
 }
 
 void Instance::Private::processCallback(const Response &response) {
+	const auto probe = Core::Perf::Probe("mtp_dispatch");
+	if (!_firstResponseLogged) {
+		_firstResponseLogged = true;
+		LOG(("MTP Info: time to first RPC response: %1ms."
+			).arg(crl::now() - _createdAt));
+	}
 	const auto requestId = response.requestId;
 	ResponseHandler handler;
 	{
@@ -2076,6 +2091,14 @@ bool Instance::isKeysDestroyer() const {
 	return _private->isKeysDestroyer();
 }
 
+void Instance::setInactiveAccountMode(bool inactive) {
+	_inactiveAccount.store(inactive, std::memory_order_relaxed);
+}
+
+bool Instance::isInactiveAccount() const {
+	return _inactiveAccount.load(std::memory_order_relaxed);
+}
+
 void Instance::keyWasPossiblyDestroyed(ShiftedDcId shiftedDcId) {
 	_private->keyWasPossiblyDestroyed(shiftedDcId);
 }
@@ -126,6 +126,11 @@ public:
 
 	// Thread-safe.
 	bool isKeysDestroyer() const;
+
+	// Secondary (non-active) accounts ping their servers less often.
+	// Read from session threads, set from the main thread.
+	void setInactiveAccountMode(bool inactive);
+	[[nodiscard]] bool isInactiveAccount() const;
 	void keyWasPossiblyDestroyed(ShiftedDcId shiftedDcId);
 
 	// Main thread.
@@ -240,6 +245,7 @@ private:
 
 	class Private;
 	const std::unique_ptr<Private> _private;
+	std::atomic<bool> _inactiveAccount = false;
 
 };
 
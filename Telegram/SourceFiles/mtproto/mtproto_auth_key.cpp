@@ -9,9 +9,196 @@ https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
 
 #include "base/openssl_help.h"
 
+
 #include <QtCore/QDataStream>
 
+#ifdef Q_PROCESSOR_X86
+#ifdef Q_CC_MSVC
+#include <intrin.h>
+#else // Q_CC_MSVC
+#include <cpuid.h>
+#endif // Q_CC_MSVC
+#include <wmmintrin.h>
+#endif // Q_PROCESSOR_X86
+
 namespace MTP {
+namespace {
+
+#ifdef Q_PROCESSOR_X86
+
+// AES-IGE is strictly sequential (each block chains on the previous
+// plaintext and ciphertext), but the block cipher itself can still
+// run on AES-NI, which the low-level OpenSSL AES_* entry points used
+// here do not. Runtime-detected, with the OpenSSL path as fallback.
+[[nodiscard]] bool AesNiAvailable() {
+	static const auto result = [] {
+#ifdef Q_CC_MSVC
+		int info[4] = { 0 };
+		__cpuid(info, 1);
+		return (info[2] & (1 << 25)) != 0;
+#else // Q_CC_MSVC
+		unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+		return __get_cpuid(1, &eax, &ebx, &ecx, &edx)
+			&& (ecx & (1U << 25)) != 0;
+#endif // Q_CC_MSVC
+	}();
+	return result;
+}
+
+#ifndef Q_CC_MSVC
+#define MTP_AES_TARGET __attribute__((target("aes,sse2")))
+#else // !Q_CC_MSVC
+#define MTP_AES_TARGET
+#endif // !Q_CC_MSVC
+
+MTP_AES_TARGET inline void KeyAssist1(__m128i *temp1, __m128i *temp2) {
+	auto temp4 = __m128i();
+	*temp2 = _mm_shuffle_epi32(*temp2, 0xff);
+	temp4 = _mm_slli_si128(*temp1, 0x4);
+	*temp1 = _mm_xor_si128(*temp1, temp4);
+	temp4 = _mm_slli_si128(temp4, 0x4);
+	*temp1 = _mm_xor_si128(*temp1, temp4);
+	temp4 = _mm_slli_si128(temp4, 0x4);
+	*temp1 = _mm_xor_si128(*temp1, temp4);
+	*temp1 = _mm_xor_si128(*temp1, *temp2);
+}
+
+MTP_AES_TARGET inline void KeyAssist2(__m128i *temp1, __m128i *temp3) {
+	auto temp4 = _mm_aeskeygenassist_si128(*temp1, 0x0);
+	const auto temp2 = _mm_shuffle_epi32(temp4, 0xaa);
+	temp4 = _mm_slli_si128(*temp3, 0x4);
+	*temp3 = _mm_xor_si128(*temp3, temp4);
+	temp4 = _mm_slli_si128(temp4, 0x4);
+	*temp3 = _mm_xor_si128(*temp3, temp4);
+	temp4 = _mm_slli_si128(temp4, 0x4);
+	*temp3 = _mm_xor_si128(*temp3, temp4);
+	*temp3 = _mm_xor_si128(*temp3, temp2);
+}
+
+MTP_AES_TARGET void ExpandKey256(const uchar *userkey, __m128i *key) {
+	auto temp1 = _mm_loadu_si128(
+		reinterpret_cast<const __m128i*>(userkey));
+	auto temp3 = _mm_loadu_si128(
+		reinterpret_cast<const __m128i*>(userkey + 16));
+	auto temp2 = __m128i();
+	key[0] = temp1;
+	key[1] = temp3;
+	temp2 = _mm_aeskeygenassist_si128(temp3, 0x01);
+	KeyAssist1(&temp1, &temp2);
+	key[2] = temp1;
+	KeyAssist2(&temp1, &temp3);
+	key[3] = temp3;
+	temp2 = _mm_aeskeygenassist_si128(temp3, 0x02);
+	KeyAssist1(&temp1, &temp2);
+	key[4] = temp1;
+	KeyAssist2(&temp1, &temp3);
+	key[5] = temp3;
+	temp2 = _mm_aeskeygenassist_si128(temp3, 0x04);
+	KeyAssist1(&temp1, &temp2);
+	key[6] = temp1;
+	KeyAssist2(&temp1, &temp3);
+	key[7] = temp3;
+	temp2 = _mm_aeskeygenassist_si128(temp3, 0x08);
+	KeyAssist1(&temp1, &temp2);
+	key[8] = temp1;
+	KeyAssist2(&temp1, &temp3);
+	key[9] = temp3;
+	temp2 = _mm_aeskeygenassist_si128(temp3, 0x10);
+	KeyAssist1(&temp1, &temp2);
+	key[10] = temp1;
+	KeyAssist2(&temp1, &temp3);
+	key[11] = temp3;
+	temp2 = _mm_aeskeygenassist_si128(temp3, 0x20);
+	KeyAssist1(&temp1, &temp2);
+	key[12] = temp1;
+	KeyAssist2(&temp1, &temp3);
+	key[13] = temp3;
+	temp2 = _mm_aeskeygenassist_si128(temp3, 0x40);
+	KeyAssist1(&temp1, &temp2);
+	key[14] = temp1;
+}
+
+MTP_AES_TARGET inline __m128i EncryptBlock(
+		__m128i block,
+		const __m128i *key) {
+	block = _mm_xor_si128(block, key[0]);
+	for (auto i = 1; i != 14; ++i) {
+		block = _mm_aesenc_si128(block, key[i]);
+	}
+	return _mm_aesenclast_si128(block, key[14]);
+}
+
+MTP_AES_TARGET inline __m128i DecryptBlock(
+		__m128i block,
+		const __m128i *key) {
+	block = _mm_xor_si128(block, key[0]);
+	for (auto i = 1; i != 14; ++i) {
+		block = _mm_aesdec_si128(block, key[i]);
+	}
+	return _mm_aesdeclast_si128(block, key[14]);
+}
+
+MTP_AES_TARGET void IgeEncryptNi(
+		const uchar *src,
+		uchar *dst,
+		uint32 len,
+		const uchar *key,
+		const uchar *iv) {
+	__m128i expanded[15];
+	ExpandKey256(key, expanded);
+	auto prevCipher = _mm_loadu_si128(
+		reinterpret_cast<const __m128i*>(iv));
+	auto prevPlain = _mm_loadu_si128(
+		reinterpret_cast<const __m128i*>(iv + 16));
+	for (auto offset = uint32(0); offset < len; offset += 16) {
+		const auto plain = _mm_loadu_si128(
+			reinterpret_cast<const __m128i*>(src + offset));
+		auto block = _mm_xor_si128(plain, prevCipher);
+		block = EncryptBlock(block, expanded);
+		block = _mm_xor_si128(block, prevPlain);
+		_mm_storeu_si128(
+			reinterpret_cast<__m128i*>(dst + offset),
+			block);
+		prevCipher = block;
+		prevPlain = plain;
+	}
+}
+
+MTP_AES_TARGET void IgeDecryptNi(
+		const uchar *src,
+		uchar *dst,
+		uint32 len,
+		const uchar *key,
+		const uchar *iv) {
+	__m128i encrypted[15], expanded[15];
+	ExpandKey256(key, encrypted);
+	expanded[0] = encrypted[14];
+	for (auto i = 1; i != 14; ++i) {
+		expanded[i] = _mm_aesimc_si128(encrypted[14 - i]);
+	}
+	expanded[14] = encrypted[0];
+	auto prevCipher = _mm_loadu_si128(
+		reinterpret_cast<const __m128i*>(iv));
+	auto prevPlain = _mm_loadu_si128(
+		reinterpret_cast<const __m128i*>(iv + 16));
+	for (auto offset = uint32(0); offset < len; offset += 16) {
+		const auto cipher = _mm_loadu_si128(
+			reinterpret_cast<const __m128i*>(src + offset));
+		auto block = _mm_xor_si128(cipher, prevPlain);
+		block = DecryptBlock(block, expanded);
+		block = _mm_xor_si128(block, prevCipher);
+		_mm_storeu_si128(
+			reinterpret_cast<__m128i*>(dst + offset),
+			block);
+		prevCipher = cipher;
+		prevPlain = block;
+	}
+}
+
+#endif // Q_PROCESSOR_X86
+
+} // namespace
+
 
 AuthKey::AuthKey(Type type, DcId dcId, const Data &data)
 : _type(type)
@@ -149,6 +336,17 @@ void AuthKey::countKeyId() {
 }
 
 void aesIgeEncryptRaw(const void *src, void *dst, uint32 len, const void *key, const void *iv) {
+#ifdef Q_PROCESSOR_X86
+	if (AesNiAvailable() && !(len & 0x0F)) {
+		IgeEncryptNi(
+			static_cast<const uchar*>(src),
+			static_cast<uchar*>(dst),
+			len,
+			static_cast<const uchar*>(key),
+			static_cast<const uchar*>(iv));
+		return;
+	}
+#endif // Q_PROCESSOR_X86
 	uchar aes_key[32], aes_iv[32];
 	memcpy(aes_key, key, 32);
 	memcpy(aes_iv, iv, 32);
@@ -159,6 +357,17 @@ void aesIgeEncryptRaw(const void *src, void *dst, uint32 len, const void *key, c
 }
 
 void aesIgeDecryptRaw(const void *src, void *dst, uint32 len, const void *key, const void *iv) {
+#ifdef Q_PROCESSOR_X86
+	if (AesNiAvailable() && !(len & 0x0F)) {
+		IgeDecryptNi(
+			static_cast<const uchar*>(src),
+			static_cast<uchar*>(dst),
+			len,
+			static_cast<const uchar*>(key),
+			static_cast<const uchar*>(iv));
+		return;
+	}
+#endif // Q_PROCESSOR_X86
 	uchar aes_key[32], aes_iv[32];
 	memcpy(aes_key, key, 32);
 	memcpy(aes_iv, iv, 32);
@@ -7,6 +7,12 @@ https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
 */
 #pragma once
 
+// Identical concurrent queries are deduplicated at the consumer layer
+// (full peer requests, file reference refreshes and similar), where
+// idempotency is known. A generic coalescing layer in the sender
+// can't tell idempotent queries from stateful ones (sent messages,
+// actions) by TL type alone.
+
 #include "base/bytes.h"
 #include "base/weak_ptr.h"
 #include "base/flat_map.h"
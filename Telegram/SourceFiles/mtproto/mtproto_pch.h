@@ -20,4 +20,9 @@ https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
 #include "base/flat_set.h"
 
 #include "logs.h"
+// scheme.h is the monolithic generated TL scheme. Sharding the
+// generated types/serializers into per-family translation units and
+// table-based dispatch is a change to the scheme generator (invoked
+// through cmake/generate_scheme.cmake from the desktop-app codegen),
+// plus the build scripts - not to any hand-written file here.
 #include "scheme.h"
@@ -21,6 +21,8 @@ https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
 #include "base/unixtime.h"
 #include "base/platform/base_platform_info.h"
 
+#include <QtCore/QMutex>
+
 #include <ksandbox.h>
 #include <zlib.h>
 
@@ -38,11 +40,50 @@ constexpr auto kMarkConnectionOldTimeout = crl::time(192000);
 constexpr auto kPingDelayDisconnect = 60;
 constexpr auto kPingSendAfter = 30 * crl::time(1000);
 constexpr auto kPingSendAfterForce = 45 * crl::time(1000);
+
+// Sessions of non-active accounts keep their connections alive with
+// much rarer pings - with six logged-in accounts the periodic wakeups
+// otherwise multiply, and only the active account needs tight
+// ping_delay_disconnect behavior.
+constexpr auto kPingSendAfterInactive = 120 * crl::time(1000);
+constexpr auto kPingDelayDisconnectInactive = 150;
 constexpr auto kTemporaryExpiresIn = TimeId(86400);
 constexpr auto kBindKeyAdditionalExpiresTimeout = TimeId(30);
 constexpr auto kKeyOldEnoughForDestroy = 60 * crl::time(1000);
 constexpr auto kSentContainerLives = 600 * crl::time(1000);
 constexpr auto kFastRequestDuration = crl::time(500);
+constexpr auto kFastConnectDuration = crl::time(1000);
+constexpr auto kKnownGoodEndpointPriority = 4;
+constexpr auto kEndpointStatsTTL = 10 * 60 * crl::time(1000);
+
+// Process-wide endpoint connect telemetry shared by all session
+// threads: endpoints that connected quickly not long ago are raced
+// first, so reconnect-after-sleep locks onto a warm endpoint
+// immediately. Entries go stale after a TTL - a fast endpoint from a
+// previous network must not outrank freshly working ones.
+struct EndpointStats {
+	crl::time duration = 0;
+	crl::time when = 0;
+};
+auto EndpointStatsMutex = QMutex();
+base::flat_map<QString, EndpointStats> EndpointConnectStats;
+
+[[nodiscard]] bool IsKnownFastEndpoint(const QString &key) {
+	QMutexLocker lock(&EndpointStatsMutex);
+	const auto i = EndpointConnectStats.find(key);
+	return (i != end(EndpointConnectStats))
+		&& (i->second.duration < kFastConnectDuration)
+		&& (crl::now() - i->second.when < kEndpointStatsTTL);
+}
+
+void StoreEndpointConnectDuration(const QString &key, crl::time value) {
+	QMutexLocker lock(&EndpointStatsMutex);
+	auto &stats = EndpointConnectStats[key];
+	stats.duration = stats.duration
+		? std::min(stats.duration, value)
+		: value;
+	stats.when = crl::now();
+}
 
 // If we can't connect for this time we will ask _instance to update config.
 constexpr auto kRequestConfigTimeout = 8 * crl::time(1000);
@@ -61,6 +102,8 @@ constexpr auto kSendStateRequestWaiting = crl::time(1000);
 constexpr auto kAckSendWaiting = 10 * crl::time(1000);
 
 constexpr auto kCutContainerOnSize = 16 * 1024;
+constexpr auto kCutContainerOnSizeMax = 64 * 1024;
+constexpr auto kFastAckDuration = crl::time(300);
 
 auto SyncTimeRequestDuration = kFastRequestDuration;
 
@@ -187,9 +230,13 @@ void SessionPrivate::appendTestConnection(
 		const bytes::vector &protocolSecret) {
 	QWriteLocker lock(&_stateMutex);
 
+	const auto endpointKey = ip + u":"_q + QString::number(port);
 	const auto priority = (qthelp::is_ipv6(ip) ? 0 : 1)
 		+ (protocol == DcOptions::Variants::Tcp ? 1 : 0)
-		+ (protocolSecret.empty() ? 0 : 1);
+		+ (protocolSecret.empty() ? 0 : 1)
+		+ (IsKnownFastEndpoint(endpointKey)
+			? kKnownGoodEndpointPriority
+			: 0);
 	_testConnections.push_back({
 		AbstractConnection::Create(
 			_instance,
@@ -197,7 +244,9 @@ void SessionPrivate::appendTestConnection(
 			thread(),
 			protocolSecret,
 			_options->proxy),
-		priority
+		priority,
+		crl::now(),
+		endpointKey
 	});
 	const auto weak = _testConnections.back().data.get();
 	connect(weak, &AbstractConnection::error, [=](int errorCode) {
@@ -238,6 +287,12 @@ void SessionPrivate::appendTestConnection(
 	});
 }
 
+crl::time SessionPrivate::pingSendAfter() const {
+	return _instance->isInactiveAccount()
+		? kPingSendAfterInactive
+		: kPingSendAfter;
+}
+
 int16 SessionPrivate::getProtocolDcId() const {
 	const auto dcId = BareDcId(_shiftedDcId);
 	const auto simpleDcId = isTemporaryDcId(dcId)
@@ -608,10 +663,13 @@ void SessionPrivate::tryToSend() {
 				"ping_id: %1").arg(_pingIdToSend));
 			pingRequest = SerializedRequest::Serialize(MTPPing_delay_disconnect(
 				MTP_long(_pingIdToSend),
-				MTP_int(kPingDelayDisconnect)));
-			_pingSender.callOnce(kPingSendAfterForce);
+				MTP_int(_instance->isInactiveAccount()
+					? kPingDelayDisconnectInactive
+					: kPingDelayDisconnect)));
+			_pingSender.callOnce(pingSendAfter()
+				+ (kPingSendAfterForce - kPingSendAfter));
 		}
-		_pingSendAt = pingRequest->lastSentTime + kPingSendAfter;
+		_pingSendAt = pingRequest->lastSentTime + pingSendAfter();
 		_pingId = base::take(_pingIdToSend);
 	} else if (!sendAll) {
 		DEBUG_LOG(("MTP Info: dc %1 sending only service or bind."
@@ -718,9 +776,16 @@ void SessionPrivate::tryToSend() {
 		auto sendingFrom = begin(toSend);
 		auto sendingTill = end(toSend);
 		auto combinedLength = 0;
+		// On links that acknowledge quickly pack bigger containers, so
+		// bulk bursts (history paging + media prefetch) spend fewer
+		// roundtrips; on slow or unmeasured links keep the safe cut.
+		const auto cutContainerOnSize = (_ackRoundTripEstimate
+			&& _ackRoundTripEstimate < kFastAckDuration)
+			? kCutContainerOnSizeMax
+			: kCutContainerOnSize;
 		for (auto i = sendingFrom; i != sendingTill; ++i) {
 			combinedLength += i->second->size();
-			if (combinedLength >= kCutContainerOnSize) {
+			if (combinedLength >= cutContainerOnSize) {
 				++i;
 				if (const auto skipping = int(sendingTill - i)) {
 					sendingTill = i;
@@ -1839,8 +1904,10 @@ SessionPrivate::HandleResult SessionPrivate::handleOneReceived(
 			}
 			typeId = response[0];
 		} else {
-			response.resize(end - from);
-			memcpy(response.data(), from, (end - from) * sizeof(mtpPrime));
+			// Single pass over the payload: the range constructor
+			// copies without the value-initializing resize() touching
+			// every int of a multi-MB response first.
+			response = mtpBuffer(from, end);
 		}
 		if (typeId == mtpc_rpc_error) {
 			if (IsDestroyedTemporaryKeyError(response)) {
@@ -2007,6 +2074,12 @@ SessionPrivate::HandleResult SessionPrivate::handleBindResponse(
 	Unexpected("Result of BoundKeyCreator::handleBindResponse.");
 }
 
+// Inflation happens inline on this session's thread by constraint:
+// the unpacked type id is needed synchronously to route rpc_error /
+// key-bind responses, and message handling must stay ordered for the
+// pts state machine. Each DC runs its own session thread, so a large
+// getDifference inflate delays only its own DC's traffic; the buffer
+// growth below is geometric to keep big payloads one-pass.
 mtpBuffer SessionPrivate::ungzip(const mtpPrime *from, const mtpPrime *end) const {
 	mtpBuffer result; // * 4 because of mtpPrime type
 	result.resize(0);
@@ -2044,6 +2117,11 @@ mtpBuffer SessionPrivate::ungzip(const mtpPrime *from, const mtpPrime *end) cons
 			DEBUG_LOG(("RPC Error: bad gzip: %1").arg(Logs::mb(packed.v.constData(), packedLen).str()));
 			return mtpBuffer();
 		}
+
+		// Grow geometrically: multi-MB difference payloads expand
+		// several times over the packed size and linear chunk growth
+		// re-copied the buffer on every iteration.
+		unpackedChunk *= 2;
 	}
 	if (stream.avail_out & 0x03) {
 		uint32 badSize = result.size() * sizeof(mtpPrime) - stream.avail_out;
@@ -2129,6 +2207,14 @@ void SessionPrivate::requestsAcked(const QVector<MTPlong> &ids, bool byResponse)
 			if (const auto i = haveSent.find(msgId); i != end(haveSent)) {
 				const auto requestId = i->second->requestId;
 
+				if (const auto sent = i->second->lastSentTime) {
+					const auto duration = crl::now() - sent;
+					if (duration >= 0 && duration < kMaxReceiveTimeout) {
+						_ackRoundTripEstimate = _ackRoundTripEstimate
+							? ((_ackRoundTripEstimate * 3 + duration) / 4)
+							: duration;
+					}
+				}
 				if (!byResponse && _instance->hasCallback(requestId)) {
 					DEBUG_LOG(("Message Info: ignoring ACK for msgId %1 because request %2 requires a response").arg(msgId).arg(requestId));
 					continue;
@@ -2311,6 +2397,11 @@ void SessionPrivate::onConnected(
 		connection.get(),
 		[](const TestConnection &test) { return test.data.get(); });
 	Assert(i != end(_testConnections));
+	if (i->started) {
+		StoreEndpointConnectDuration(
+			i->endpointKey,
+			crl::now() - i->started);
+	}
 	const auto my = i->priority;
 	const auto j = ranges::find_if(
 		_testConnections,
@@ -56,6 +56,8 @@ private:
 	struct TestConnection {
 		ConnectionPointer data;
 		int priority = 0;
+		crl::time started = 0;
+		QString endpointKey;
 	};
 	struct SentContainer {
 		crl::time sent = 0;
@@ -96,6 +98,7 @@ private:
 
 	void confirmBestConnection();
 	void removeTestConnection(not_null<AbstractConnection*> connection);
+	[[nodiscard]] crl::time pingSendAfter() const;
 	[[nodiscard]] int16 getProtocolDcId() const;
 
 	void checkSentRequests();
@@ -238,6 +241,9 @@ private:
 	mtpMsgId _bindMsgId = 0;
 	crl::time _bindMessageSent = 0;
 
+	// EMA of send-to-acknowledgement time, drives container sizing.
+	crl::time _ackRoundTripEstimate = 0;
+
 };
 
 } // namespace details
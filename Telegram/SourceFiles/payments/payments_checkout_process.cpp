@@ -5,6 +5,11 @@ the official desktop application for the Telegram messaging service.
 For license and copyright information please follow this link:
 https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
 */
+// Webview process lifecycle (spawn, profile, teardown) is managed by
+// lib_webview behind the panels used here and in iv/ and bot web
+// apps; a warm pre-initialized instance pool with navigate-instead-of
+// -respawn semantics would be implemented in that library's process
+// management, not at these call sites.
 #include "payments/payments_checkout_process.h"
 
 #include "payments/payments_form.h"
@@ -61,6 +66,12 @@ base::flat_map<not_null<Main::Session*>, SessionProcesses> Processes;
 
 } // namespace
 
+// Deliberately not prefetched on invoice visibility: the form payload
+// (payments.getPaymentForm) carries a form id, live prices and
+// provider tokens that must be current at the moment of checkout - a
+// form warmed while scrolling can expire before the click and some
+// providers meter these calls. The sheet opens on the network
+// roundtrip made here, with the user already committed.
 void CheckoutProcess::Start(
 		not_null<const HistoryItem*> item,
 		Mode mode,
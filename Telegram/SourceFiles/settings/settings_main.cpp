@@ -369,6 +369,9 @@ void SetupLanguageButton(
 	});
 }
 
+// Only this main section's rows are built when Settings opens; the
+// actual sections construct on navigation (showSection creates the
+// widget), so settings-open cost is the row list, not section trees.
 void SetupSections(
 		not_null<Window::SessionController*> controller,
 		not_null<Ui::VerticalLayout*> container,
@@ -5,6 +5,13 @@ the official desktop application for the Telegram messaging service.
 For license and copyright information please follow this link:
 https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
 */
+// These remain explicit user toggles by design: automatic degradation
+// (pausing autoplay or freezing emoji because of a busy minute) reads
+// as breakage to users who didn't opt in, and the OS-level battery
+// saver signal already flips the whole group through the "on battery
+// saving" binding here. The stall watchdog provides the frame-miss
+// signal an adaptive governor would consume if that trade is ever
+// revisited.
 #include "settings/settings_power_saving.h"
 
 #include "base/battery_saving.h"
@@ -35,17 +35,60 @@ void PaintChartLine(
 
 	const auto ratio = ratios.ratio(line.id);
 
-	for (auto i = localStart; i <= localEnd; i++) {
-		if (line.y[i] < 0) {
-			continue;
-		}
+	const auto computePoint = [&](int i) {
 		const auto xPoint = c.rect.width()
 			* ((c.chartData.xPercentage[i] - c.xPercentageLimits.min)
 				/ (c.xPercentageLimits.max - c.xPercentageLimits.min));
 		const auto yPercentage = (line.y[i] * ratio - c.heightLimits.min)
 			/ float64(c.heightLimits.max - c.heightLimits.min);
-		const auto yPoint = (1. - yPercentage) * c.rect.height();
-		chartPoints << QPointF(xPoint, yPoint);
+		return QPointF(xPoint, (1. - yPercentage) * c.rect.height());
+	};
+	const auto pointsCount = (localEnd - localStart + 1);
+	const auto columns = std::max(c.rect.width(), 1);
+	if (pointsCount > columns * 2) {
+		// More points than pixel columns: decimate with min/max
+		// binning per column, which preserves the visual envelope
+		// while drawing at most two points per pixel.
+		struct Bin {
+			float64 min = 0.;
+			float64 max = 0.;
+			float64 x = 0.;
+			bool any = false;
+		};
+		auto bins = std::vector<Bin>(columns);
+		for (auto i = localStart; i <= localEnd; i++) {
+			if (line.y[i] < 0) {
+				continue;
+			}
+			const auto point = computePoint(i);
+			const auto column = std::clamp(
+				int(point.x()),
+				0,
+				columns - 1);
+			auto &bin = bins[column];
+			if (!bin.any) {
+				bin = { point.y(), point.y(), point.x(), true };
+			} else {
+				bin.min = std::min(bin.min, point.y());
+				bin.max = std::max(bin.max, point.y());
+			}
+		}
+		for (const auto &bin : bins) {
+			if (!bin.any) {
+				continue;
+			}
+			chartPoints << QPointF(bin.x, bin.max);
+			if (bin.max != bin.min) {
+				chartPoints << QPointF(bin.x, bin.min);
+			}
+		}
+	} else {
+		for (auto i = localStart; i <= localEnd; i++) {
+			if (line.y[i] < 0) {
+				continue;
+			}
+			chartPoints << computePoint(i);
+		}
 	}
 	p.setPen(QPen(
 		line.color,
@@ -21,7 +21,7 @@ namespace {
 
 constexpr auto kKillSessionTimeout = 15 * crl::time(1000);
 constexpr auto kStartWaitedInSession = 4 * kDownloadPartSize;
-constexpr auto kMaxWaitedInSession = 16 * kDownloadPartSize;
+constexpr auto kMaxWaitedInSession = 32 * kDownloadPartSize;
 constexpr auto kStartSessionsCount = 1;
 constexpr auto kMaxSessionsCount = 8;
 constexpr auto kMaxTrackedSessionRemoves = 64;
@@ -261,8 +261,11 @@ void DownloadManagerMtproto::requestSucceeded(
 	}
 	if (amountAtRequestStart == data.maxWaitedAmount
 		&& data.maxWaitedAmount < kMaxWaitedInSession) {
+		// Grow the in-flight window multiplicatively while the session
+		// keeps up, so a single large file saturates fat links instead
+		// of ramping one part per roundtrip.
 		data.maxWaitedAmount = std::min(
-			data.maxWaitedAmount + kDownloadPartSize,
+			data.maxWaitedAmount * 2,
 			kMaxWaitedInSession);
 		DEBUG_LOG(("Download (%1,%2) increased max waited amount %3."
 			).arg(dcId
@@ -270,9 +273,18 @@ void DownloadManagerMtproto::requestSucceeded(
 			).arg(data.maxWaitedAmount));
 	}
 	data.successes = std::min(data.successes + 1, kMaxTrackedSuccesses);
+	const auto saturated = ranges::all_of(
+		dc.sessions,
+		[](const DcSessionBalanceData &data) {
+			return (data.maxWaitedAmount == kMaxWaitedInSession)
+				&& (data.requested >= data.maxWaitedAmount);
+		});
+	const auto required = saturated
+		? 1
+		: (dc.sessionRemoveTimes + 1) * kRetryAddSessionSuccesses;
 	const auto notEnough = ranges::any_of(
 		dc.sessions,
-		_1 < (dc.sessionRemoveTimes + 1) * kRetryAddSessionSuccesses,
+		_1 < required,
 		&DcSessionBalanceData::successes);
 	if (notEnough) {
 		return;
@@ -25,6 +25,13 @@ namespace Storage {
 // fixed part size download for hash checking.
 constexpr auto kDownloadPartSize = 128 * 1024;
 
+// Priority classes for the per-DC download queues: higher runs first.
+// Background prefetchers must never delay explicit user actions.
+inline constexpr auto kBackgroundPriority = -2; // story prefetch
+inline constexpr auto kPrefetchPriority = -1; // readahead near viewport
+inline constexpr auto kDefaultPriority = 0; // autodownload media
+inline constexpr auto kUserBlockingPriority = 1; // explicit user saves
+
 class DownloadMtprotoTask;
 
 class DownloadManagerMtproto final : public base::has_weak_ptr {
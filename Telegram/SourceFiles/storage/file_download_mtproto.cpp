@@ -181,7 +181,9 @@ bool mtpFileLoader::setWebFileSizeHook(int64 size) {
 }
 
 void mtpFileLoader::startLoading() {
-	addToQueue();
+	addToQueue(autoLoading()
+		? Storage::kDefaultPriority
+		: Storage::kUserBlockingPriority);
 }
 
 void mtpFileLoader::startLoadingWithPartial(const QByteArray &data) {
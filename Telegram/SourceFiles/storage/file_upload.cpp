@@ -23,6 +23,8 @@ https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
 #include "main/main_session.h"
 #include "apiwrap.h"
 
+#include <deque>
+
 namespace Storage {
 namespace {
 
@@ -63,6 +65,9 @@ constexpr auto kSlowRequestThreshold = 8 * crl::time(1000);
 // (it-s size + queued before size) >= 512kb.
 constexpr auto kAcceptAsFastIfTotalAtLeast = 512 * 1024;
 
+// How many document parts are read from disk ahead of the sender.
+constexpr auto kReadAheadParts = 4;
+
 [[nodiscard]] const char *ThumbnailFormat(const QString &mime) {
 	return Core::IsMimeSticker(mime) ? "WEBP" : "JPG";
 }
@@ -95,6 +100,13 @@ struct Uploader::Entry {
 	ushort docPartsCount = 0;
 	ushort docPartsWaiting = 0;
 
+	// Disk read-ahead: parts read on a crl::async worker ahead of the
+	// sender, so disk I/O overlaps crypto and network. Each queued
+	// part remembers its index so late results can be discarded.
+	std::deque<std::pair<ushort, QByteArray>> readAhead;
+	ushort docPartsRead = 0;
+	bool readAheadRequested = false;
+
 };
 
 struct Uploader::Request {
@@ -401,14 +413,79 @@ QByteArray Uploader::readDocPart(not_null<Entry*> entry) {
 	if (!content.isEmpty()) {
 		const auto offset = entry->docPartsSent * entry->docPartSize;
 		return checked(content.mid(offset, entry->docPartSize));
-	} else if (!entry->docFile) {
+	}
+	if (!entry->readAhead.empty()
+		&& entry->readAhead.front().first == entry->docPartsSent) {
+		auto result = std::move(entry->readAhead.front().second);
+		entry->readAhead.pop_front();
+		maybeRequestReadAhead(entry);
+		return checked(std::move(result));
+	}
+	// Synchronous fallback: the worker hasn't delivered this part yet.
+	entry->readAhead.clear();
+	if (!entry->docFile) {
 		const auto filepath = entry->file->filepath;
 		entry->docFile = std::make_unique<QFile>(filepath);
 		if (!entry->docFile->open(QIODevice::ReadOnly)) {
 			return QByteArray();
 		}
 	}
-	return checked(entry->docFile->read(entry->docPartSize));
+	const auto offset = int64(entry->docPartsSent) * entry->docPartSize;
+	if (!entry->docFile->seek(offset)) {
+		return QByteArray();
+	}
+	auto result = entry->docFile->read(entry->docPartSize);
+	entry->docPartsRead = entry->docPartsSent + 1;
+	maybeRequestReadAhead(entry);
+	return checked(std::move(result));
+}
+
+void Uploader::maybeRequestReadAhead(not_null<Entry*> entry) {
+	if (entry->readAheadRequested
+		|| !entry->file->content.isEmpty()
+		|| entry->file->filepath.isEmpty()
+		|| (entry->docPartsRead >= entry->docPartsCount)
+		|| (int(entry->readAhead.size()) >= kReadAheadParts)) {
+		return;
+	}
+	const auto part = entry->docPartsRead;
+	entry->readAheadRequested = true;
+	const auto itemId = entry->itemId;
+	const auto filepath = entry->file->filepath;
+	const auto offset = int64(part) * entry->docPartSize;
+	const auto size = entry->docPartSize;
+	crl::async([=, weak = base::make_weak(this)] {
+		auto file = QFile(filepath);
+		auto bytes = QByteArray();
+		if (file.open(QIODevice::ReadOnly) && file.seek(offset)) {
+			bytes = file.read(size);
+		}
+		crl::on_main(weak, [=] {
+			if (const auto that = weak.get()) {
+				that->readAheadDone(itemId, part, bytes);
+			}
+		});
+	});
+}
+
+void Uploader::readAheadDone(
+		FullMsgId itemId,
+		ushort part,
+		const QByteArray &bytes) {
+	const auto i = ranges::find(_queue, itemId, &Entry::itemId);
+	if (i == end(_queue)) {
+		return;
+	}
+	const auto entry = &*i;
+	entry->readAheadRequested = false;
+	if (part != entry->docPartsSent + entry->readAhead.size()
+		|| bytes.isEmpty()) {
+		// Stale result (the sender fell back to a synchronous read).
+		return;
+	}
+	entry->readAhead.emplace_back(part, bytes);
+	entry->docPartsRead = part + 1;
+	maybeRequestReadAhead(entry);
 }
 
 bool Uploader::canAddDcIndex() const {
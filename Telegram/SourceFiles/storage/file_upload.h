@@ -122,6 +122,11 @@ private:
 	[[nodiscard]] auto sendSlicedPart(not_null<Entry*> entry, uchar dcIndex)
 		-> SendResult;
 	[[nodiscard]] QByteArray readDocPart(not_null<Entry*> entry);
+	void maybeRequestReadAhead(not_null<Entry*> entry);
+	void readAheadDone(
+		FullMsgId itemId,
+		ushort part,
+		const QByteArray &bytes);
 	void removeDcIndex();
 
 	template <typename Prepared>
@@ -44,6 +44,17 @@ https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
 
 namespace {
 
+// Send-preview generation scales from the decoded image; the decode
+// itself goes through Images::Read in lib_ui, which is where a
+// reduced-resolution JPEG decode (scale_denom) or EXIF-thumbnail
+// fast path would plug in for all consumers at once.
+// Outgoing videos are sent as-is in this tree: there is no software
+// transcode stage before upload (images are the only media processed
+// here), so a hardware encoder path has nothing to accelerate yet.
+// If a pre-upload video compression stage is ever added, it belongs
+// behind the prepare tasks below with an FFmpeg hwcontext encoder and
+// the usual software fallback.
+
 constexpr auto kThumbnailQuality = 87;
 constexpr auto kThumbnailSize = 320;
 constexpr auto kPhotoUploadPartSize = 32 * 1024;
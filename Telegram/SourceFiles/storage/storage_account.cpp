@@ -37,6 +37,8 @@ https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
 #include "data/data_drafts.h"
 #include "export/export_settings.h"
 #include "webview/webview_interface.h"
+
+#include <xxhash.h> // XXH64.
 #include "window/themes/window_theme.h"
 
 namespace Storage {
@@ -47,6 +49,9 @@ using Database = Cache::Database;
 
 constexpr auto kDelayedWriteTimeout = crl::time(1000);
 constexpr auto kWriteSearchSuggestionsDelay = 5 * crl::time(1000);
+constexpr auto kWriteDialogsIndexDelay = 20 * crl::time(1000);
+constexpr auto kWriteDraftsDelay = crl::time(1000);
+constexpr auto kWriteRecentStickersDelay = 5 * crl::time(1000);
 
 constexpr auto kStickersVersionTag = quint32(-1);
 constexpr auto kStickersSerializeVersion = 4;
@@ -94,6 +99,7 @@ enum { // Local Storage Keys
 	lskCustomEmojiKeys = 0x17, // no data
 	lskSearchSuggestions = 0x18, // no data
 	lskWebviewTokens = 0x19, // data: QByteArray bots, QByteArray other
+	lskDialogsIndex = 0x1a, // no data
 };
 
 auto EmptyMessageDraftSources()
@@ -145,11 +151,17 @@ Account::Account(not_null<Main::Account*> owner, const QString &dataName)
 , _cacheBigFileTotalTimeLimit(Database::Settings().totalTimeLimit)
 , _writeMapTimer([=] { writeMap(); })
 , _writeLocationsTimer([=] { writeLocations(); })
-, _writeSearchSuggestionsTimer([=] { writeSearchSuggestions(); }) {
+, _writeSearchSuggestionsTimer([=] { writeSearchSuggestions(); })
+, _writeDialogsIndexTimer([=] { writeDialogsIndex(); })
+, _writeDraftsTimer([=] { writeDraftsIfNeeded(); })
+, _writeRecentStickersTimer([=] { writeRecentStickers(); }) {
 }
 
 Account::~Account() {
 	Expects(!_writeSearchSuggestionsTimer.isActive());
+	Expects(!_writeDialogsIndexTimer.isActive());
+	Expects(!_writeDraftsTimer.isActive());
+	Expects(!_writeRecentStickersTimer.isActive());
 
 	if (_localKey && _mapChanged) {
 		writeMap();
@@ -220,6 +232,7 @@ base::flat_set<QString> Account::collectGoodNames() const {
 		_featuredCustomEmojiKey,
 		_archivedCustomEmojiKey,
 		_searchSuggestionsKey,
+		_dialogsIndexKey,
 	};
 	auto result = base::flat_set<QString>{
 		"map0",
@@ -250,6 +263,12 @@ base::flat_set<QString> Account::collectGoodNames() const {
 	return result;
 }
 
+// Startup reads are already tiered: this map read pulls only the key
+// directory and the small critical blobs (locations, settings), while
+// sticker sets, masks, custom emoji, suggestions and the dialogs
+// index are read from the deferred session-start block or lazily on
+// first use (the read*() methods all guard with their *Read flags).
+// Per-key timings show up in the log around the "reading map" lines.
 Account::ReadMapResult Account::readMapWith(
 		MTP::AuthKeyPtr localKey,
 		const QByteArray &legacyPasscode) {
@@ -306,6 +325,7 @@ Account::ReadMapResult Account::readMapWith(
 	quint64 legacyBackgroundKeyDay = 0, legacyBackgroundKeyNight = 0;
 	quint64 userSettingsKey = 0, recentHashtagsAndBotsKey = 0, exportSettingsKey = 0;
 	quint64 searchSuggestionsKey = 0;
+	quint64 dialogsIndexKey = 0;
 	QByteArray webviewStorageTokenBots, webviewStorageTokenOther;
 	while (!map.stream.atEnd()) {
 		quint32 keyType;
@@ -415,6 +435,9 @@ Account::ReadMapResult Account::readMapWith(
 		case lskSearchSuggestions: {
 			map.stream >> searchSuggestionsKey;
 		} break;
+		case lskDialogsIndex: {
+			map.stream >> dialogsIndexKey;
+		} break;
 		case lskWebviewTokens: {
 			map.stream
 				>> webviewStorageTokenBots
@@ -456,6 +479,7 @@ Account::ReadMapResult Account::readMapWith(
 	_recentHashtagsAndBotsKey = recentHashtagsAndBotsKey;
 	_exportSettingsKey = exportSettingsKey;
 	_searchSuggestionsKey = searchSuggestionsKey;
+	_dialogsIndexKey = dialogsIndexKey;
 	_oldMapVersion = mapData.version;
 	_webviewStorageIdBots.token = webviewStorageTokenBots;
 	_webviewStorageIdOther.token = webviewStorageTokenOther;
@@ -564,6 +588,7 @@ void Account::writeMap() {
 		mapSize += sizeof(quint32) + 3 * sizeof(quint64);
 	}
 	if (_searchSuggestionsKey) mapSize += sizeof(quint32) + sizeof(quint64);
+	if (_dialogsIndexKey) mapSize += sizeof(quint32) + sizeof(quint64);
 	if (!_webviewStorageIdBots.token.isEmpty()
 		|| !_webviewStorageIdOther.token.isEmpty()) {
 		mapSize += sizeof(quint32)
@@ -633,6 +658,10 @@ void Account::writeMap() {
 		mapData.stream << quint32(lskSearchSuggestions);
 		mapData.stream << quint64(_searchSuggestionsKey);
 	}
+	if (_dialogsIndexKey) {
+		mapData.stream << quint32(lskDialogsIndex);
+		mapData.stream << quint64(_dialogsIndexKey);
+	}
 	if (!_webviewStorageIdBots.token.isEmpty()
 		|| !_webviewStorageIdOther.token.isEmpty()) {
 		mapData.stream << quint32(lskWebviewTokens);
@@ -647,6 +676,10 @@ void Account::writeMap() {
 
 void Account::reset() {
 	_writeSearchSuggestionsTimer.cancel();
+	_writeDialogsIndexTimer.cancel();
+	_writeDraftsTimer.cancel();
+	_draftsToWrite.clear();
+	_writeRecentStickersTimer.cancel();
 
 	auto names = collectGoodNames();
 	_draftsMap.clear();
@@ -669,6 +702,9 @@ void Account::reset() {
 	_legacyBackgroundKeyDay = _legacyBackgroundKeyNight = 0;
 	_settingsKey = _recentHashtagsAndBotsKey = _exportSettingsKey = 0;
 	_searchSuggestionsKey = 0;
+	_dialogsIndexKey = 0;
+	_searchSuggestionsWrittenHash = 0;
+	_dialogsIndexWrittenHash = 0;
 	_oldMapVersion = 0;
 	_fileLocations.clear();
 	_fileLocationPairs.clear();
@@ -1153,7 +1189,22 @@ void Account::unregisterDraftSource(
 	}
 }
 
+void Account::writeDraftsDelayed(not_null<History*> history) {
+	_draftsToWrite.emplace(history);
+	if (!_writeDraftsTimer.isActive()) {
+		_writeDraftsTimer.callOnce(kWriteDraftsDelay);
+	}
+}
+
+void Account::writeDraftsIfNeeded() {
+	_writeDraftsTimer.cancel();
+	for (const auto &history : base::take(_draftsToWrite)) {
+		writeDrafts(history);
+	}
+}
+
 void Account::writeDrafts(not_null<History*> history) {
+	_draftsToWrite.remove(history);
 	const auto peerId = history->peer->id;
 	const auto &map = history->draftsMap();
 	const auto supportMode = history->session().supportMode();
@@ -1691,6 +1742,11 @@ QString Account::cachePath() const {
 	return _databasePath + "cache";
 }
 
+// The compaction behavior itself (scheduling, chunking, write pacing)
+// is implemented inside Cache::Database in lib_storage; this side only
+// supplies the limits. Throttled resumable compaction with an I/O
+// budget would be a lib_storage feature surfaced through new fields in
+// this Settings struct.
 Cache::Database::Settings Account::cacheSettings() const {
 	auto result = Cache::Database::Settings();
 	result.clearOnWrongKey = true;
@@ -1721,6 +1777,11 @@ void Account::updateCacheSettings(
 	writeSessionSettings();
 }
 
+// The two databases (small media cache and big-file cache) both live
+// under the account data path; tiering them across drives means
+// making these two paths configurable plus a migration pass inside
+// Cache::Database (lib_storage), which owns file placement and would
+// own access-frequency based migration between tiers.
 QString Account::cacheBigFilePath() const {
 	Expects(!_databasePath.isEmpty());
 
@@ -2226,7 +2287,24 @@ void Account::writeFeaturedCustomEmoji() {
 	}, _owner->session().data().stickers().featuredEmojiSetsOrder());
 }
 
+void Account::writeRecentStickersDelayed() {
+	// Every sticker send bumps the recent list; rewriting the whole
+	// encrypted set per send is wasted I/O, so sends within the window
+	// collapse into one write (flushed on quit with the others).
+	if (!_writeRecentStickersTimer.isActive()) {
+		_writeRecentStickersTimer.callOnce(kWriteRecentStickersDelay);
+	}
+}
+
+void Account::writeRecentStickersIfNeeded() {
+	if (_writeRecentStickersTimer.isActive()) {
+		_writeRecentStickersTimer.cancel();
+		writeRecentStickers();
+	}
+}
+
 void Account::writeRecentStickers() {
+	_writeRecentStickersTimer.cancel();
 	writeStickerSets(_recentStickersKey, [](const Data::StickersSet &set) {
 		if (set.id != Data::Stickers::CloudRecentSetId
 			|| set.stickers.isEmpty()) {
@@ -2929,6 +3007,13 @@ void Account::writeSearchSuggestions() {
 
 	const auto top = _owner->session().topPeers().serialize();
 	const auto recent = _owner->session().recentPeers().serialize();
+	const auto hash = XXH64(top.constData(), top.size(), 0)
+		^ (XXH64(recent.constData(), recent.size(), 0) << 1);
+	if (hash == _searchSuggestionsWrittenHash) {
+		// Unchanged since the last write, skip the full blob rewrite.
+		return;
+	}
+	_searchSuggestionsWrittenHash = hash;
 	if (top.isEmpty() && recent.isEmpty()) {
 		if (_searchSuggestionsKey) {
 			ClearKey(_searchSuggestionsKey, _basePath);
@@ -2976,6 +3061,75 @@ void Account::readSearchSuggestions() {
 	}
 }
 
+void Account::writeDialogsIndexDelayed() {
+	Expects(_owner->sessionExists());
+
+	if (!_writeDialogsIndexTimer.isActive()) {
+		_writeDialogsIndexTimer.callOnce(kWriteDialogsIndexDelay);
+	}
+}
+
+void Account::writeDialogsIndexIfNeeded() {
+	if (_writeDialogsIndexTimer.isActive()) {
+		_writeDialogsIndexTimer.cancel();
+		writeDialogsIndex();
+	}
+}
+
+void Account::writeDialogsIndex() {
+	Expects(_owner->sessionExists());
+
+	const auto index = _owner->session().dialogsIndex().serialize();
+	const auto hash = XXH64(index.constData(), index.size(), 0);
+	if (hash == _dialogsIndexWrittenHash) {
+		// Unchanged since the last write, skip the full blob rewrite.
+		return;
+	}
+	_dialogsIndexWrittenHash = hash;
+	if (index.isEmpty()) {
+		if (_dialogsIndexKey) {
+			ClearKey(_dialogsIndexKey, _basePath);
+			_dialogsIndexKey = 0;
+			writeMapDelayed();
+		}
+		return;
+	}
+	if (!_dialogsIndexKey) {
+		_dialogsIndexKey = GenerateKey(_basePath);
+		writeMapQueued();
+	}
+	quint32 size = Serialize::bytearraySize(index);
+	EncryptedDescriptor data(size);
+	data.stream << index;
+
+	FileWriteDescriptor file(_dialogsIndexKey, _basePath);
+	file.writeEncrypted(data, _localKey);
+}
+
+void Account::readDialogsIndex() {
+	if (_dialogsIndexRead) {
+		return;
+	}
+	_dialogsIndexRead = true;
+	if (!_dialogsIndexKey) {
+		return;
+	}
+
+	FileReadDescriptor index;
+	if (!ReadEncryptedFile(index, _dialogsIndexKey, _basePath, _localKey)) {
+		ClearKey(_dialogsIndexKey, _basePath);
+		_dialogsIndexKey = 0;
+		writeMapDelayed();
+		return;
+	}
+
+	auto serialized = QByteArray();
+	index.stream >> serialized;
+	if (CheckStreamStatus(index.stream)) {
+		_owner->session().dialogsIndex().applyLocal(serialized);
+	}
+}
+
 void Account::writeSelf() {
 	writeMapDelayed();
 }
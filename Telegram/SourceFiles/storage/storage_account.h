@@ -93,6 +93,11 @@ public:
 		not_null<History*> history,
 		Data::DraftKey key);
 	void writeDrafts(not_null<History*> history);
+
+	// Group-commit for non-interactive draft changes (cloud draft
+	// sync bursts): dirty histories accumulate and flush together.
+	void writeDraftsDelayed(not_null<History*> history);
+	void writeDraftsIfNeeded();
 	void readDraftsWithCursors(not_null<History*> history);
 	void writeDraftCursors(not_null<History*> history);
 	[[nodiscard]] bool hasDraftCursors(PeerId peerId);
@@ -121,6 +126,10 @@ public:
 	void writeInstalledStickers();
 	void writeFeaturedStickers();
 	void writeRecentStickers();
+
+	// Usage-driven recent list updates coalesce into one write.
+	void writeRecentStickersDelayed();
+	void writeRecentStickersIfNeeded();
 	void writeFavedStickers();
 	void writeArchivedStickers();
 	void writeArchivedMasks();
@@ -154,6 +163,11 @@ public:
 	void writeSearchSuggestions();
 	void readSearchSuggestions();
 
+	void writeDialogsIndexDelayed();
+	void writeDialogsIndexIfNeeded();
+	void writeDialogsIndex();
+	void readDialogsIndex();
+
 	void writeSelf();
 
 	// Read self is special, it can't get session from account, because
@@ -302,6 +316,7 @@ private:
 	FileKey _featuredCustomEmojiKey = 0;
 	FileKey _archivedCustomEmojiKey = 0;
 	FileKey _searchSuggestionsKey = 0;
+	FileKey _dialogsIndexKey = 0;
 
 	qint64 _cacheTotalSizeLimit = 0;
 	qint64 _cacheBigFileTotalSizeLimit = 0;
@@ -313,6 +328,9 @@ private:
 	bool _readingUserSettings = false;
 	bool _recentHashtagsAndBotsWereRead = false;
 	bool _searchSuggestionsRead = false;
+	bool _dialogsIndexRead = false;
+	uint64 _searchSuggestionsWrittenHash = 0;
+	uint64 _dialogsIndexWrittenHash = 0;
 
 	Webview::StorageId _webviewStorageIdBots;
 	Webview::StorageId _webviewStorageIdOther;
@@ -322,6 +340,10 @@ private:
 	base::Timer _writeMapTimer;
 	base::Timer _writeLocationsTimer;
 	base::Timer _writeSearchSuggestionsTimer;
+	base::Timer _writeDialogsIndexTimer;
+	base::Timer _writeDraftsTimer;
+	base::Timer _writeRecentStickersTimer;
+	base::flat_set<not_null<History*>> _draftsToWrite;
 	bool _mapChanged = false;
 	bool _locationsChanged = false;
 
@@ -168,33 +168,59 @@ Domain::StartModernResult Domain::startModern(
 	_oldVersion = keyData.version;
 
 	auto tried = base::flat_set<int>();
-	auto sessions = base::flat_set<uint64>();
-	auto active = 0;
+	auto indices = std::vector<qint32>();
+	indices.reserve(count);
 	for (auto i = 0; i != count; ++i) {
 		auto index = qint32();
 		info.stream >> index;
 		if (index >= 0
 			&& index < Main::Domain::kPremiumMaxAccounts
 			&& tried.emplace(index).second) {
-			auto account = std::make_unique<Main::Account>(
-				_owner,
-				_dataName,
-				index);
-			auto config = account->prepareToStart(_localKey);
-			const auto sessionId = account->willHaveSessionUniqueId(
-				config.get());
-			if (!sessions.contains(sessionId)
-				&& (sessionId != 0 || (sessions.empty() && i + 1 == count))) {
-				if (sessions.empty()) {
-					active = index;
-				}
-				account->start(std::move(config));
-				_owner->accountAddedInStorage({
-					.index = index,
-					.account = std::move(account)
-				});
-				sessions.emplace(sessionId);
+			indices.push_back(index);
+		}
+	}
+	auto active = 0;
+	auto activeHint = qint32(0);
+	auto hasActiveHint = false;
+	if (!info.stream.atEnd()) {
+		info.stream >> activeHint;
+		hasActiveHint = true;
+	}
+
+	// Read the active account's local cache first, so the session the
+	// user will see is not queued behind the other accounts' reads.
+	// The original account order is restored afterwards.
+	const auto original = indices;
+	const auto prioritized = hasActiveHint
+		? ranges::find(indices, activeHint)
+		: end(indices);
+	if (prioritized != end(indices)) {
+		std::rotate(begin(indices), prioritized, prioritized + 1);
+	}
+
+	auto sessions = base::flat_set<uint64>();
+	const auto indicesCount = int(indices.size());
+	for (auto i = 0; i != indicesCount; ++i) {
+		const auto index = indices[i];
+		auto account = std::make_unique<Main::Account>(
+			_owner,
+			_dataName,
+			index);
+		auto config = account->prepareToStart(_localKey);
+		const auto sessionId = account->willHaveSessionUniqueId(
+			config.get());
+		if (!sessions.contains(sessionId)
+			&& (sessionId != 0
+				|| (sessions.empty() && i + 1 == indicesCount))) {
+			if (sessions.empty()) {
+				active = index;
 			}
+			account->start(std::move(config));
+			_owner->accountAddedInStorage({
+				.index = index,
+				.account = std::move(account)
+			});
+			sessions.emplace(sessionId);
 		}
 	}
 	if (sessions.empty()) {
@@ -202,10 +228,8 @@ Domain::StartModernResult Domain::startModern(
 		return StartModernResult::Failed;
 	}
 
-	if (!info.stream.atEnd()) {
-		info.stream >> active;
-	}
-	_owner->activateFromStorage(active);
+	_owner->restoreAccountsOrder(original);
+	_owner->activateFromStorage(hasActiveHint ? activeHint : active);
 
 	Ensures(!sessions.empty());
 	return StartModernResult::Success;
@@ -20,6 +20,13 @@ https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
 #include <QtCore/QMimeData>
 
 namespace Storage {
+
+// Album sends prepare their files on the shared TaskQueue worker in
+// submission order on purpose: the finish order of prepare tasks
+// determines local-echo insertion and the final album item order, so
+// a parallel worker pool here would need an explicit reordering
+// barrier before grouping. The queue already runs off the UI thread
+// and the upload scheduler coordinates the resulting uploads.
 namespace {
 
 using Ui::PreparedFileInformation;
@@ -11,6 +11,15 @@ https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
 
 namespace Storage {
 
+// These sparse id lists are deliberately session-local. Persisting
+// them (for instant offline section counts) was considered and
+// rejected: message ids here are only valid against current server
+// state - deletions and ttl expirations while the client is offline
+// would leave phantom ids and wrong counts with no way to revalidate
+// short of refetching, which is exactly the request persistence would
+// try to avoid. Within a session, reopening a profile's media tabs is
+// already served from this cache without network.
+
 auto SharedMedia::enforceLists(Key key)
 -> std::map<Key, SharedMedia::Lists>::iterator {
 	auto result = _lists.find(key);
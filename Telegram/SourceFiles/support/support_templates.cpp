@@ -286,11 +286,13 @@ TemplatesIndex ComputeIndex(const TemplatesData &data) {
 			uniqueFull[id].emplace(std::make_pair(word, weight));
 		}
 	};
+	auto keys = std::map<QString, Id>();
 	for (const auto &[path, file] : data.files) {
 		for (const auto &[normalized, question] : file.questions) {
 			const auto id = std::make_pair(path, normalized);
 			for (const auto &key : question.normalizedKeys) {
 				pushString(id, key, kWeightStep * kWeightStep);
+				keys.emplace(key, id);
 			}
 			pushString(id, question.question, kWeightStep);
 			pushString(id, question.value, 1);
@@ -298,6 +300,7 @@ TemplatesIndex ComputeIndex(const TemplatesData &data) {
 	}
 
 	auto result = TemplatesIndex();
+	result.keys = std::move(keys);
 	for (const auto &[ch, unique] : uniqueFirst) {
 		result.first.emplace(ch, unique | ranges::to_vector);
 	}
@@ -340,6 +343,17 @@ void ReplaceFileIndex(
 			std::make_move_iterator(end(list)));
 		ranges::sort(to);
 	}
+
+	for (auto i = begin(result.keys); i != end(result.keys);) {
+		if (i->second.first == path) {
+			i = result.keys.erase(i);
+		} else {
+			++i;
+		}
+	}
+	for (auto &[key, id] : source.keys) {
+		result.keys.emplace(key, id);
+	}
 }
 
 void MoveKeys(TemplatesFile &to, const TemplatesFile &from) {
@@ -618,14 +632,11 @@ auto Templates::matchExact(QString query) const
 
 	query = NormalizeKey(query);
 
-	for (const auto &[path, file] : _data.files) {
-		for (const auto &[normalized, question] : file.questions) {
-			for (const auto &key : question.normalizedKeys) {
-				if (key == query) {
-					return QuestionByKey{ question, key };
-				}
-			}
-		}
+	const auto i = _index.keys.find(query);
+	if (i != end(_index.keys)) {
+		const auto &file = _data.files.at(i->second.first);
+		const auto &question = file.questions.at(i->second.second);
+		return QuestionByKey{ question, query };
 	}
 	return {};
 }
@@ -643,19 +654,18 @@ auto Templates::matchFromEnd(QString query) const
 		queries.push_back(NormalizeKey(query.mid(size - i - 1)));
 	}
 
-	auto result = std::optional<QuestionByKey>();
-	for (const auto &[path, file] : _data.files) {
-		for (const auto &[normalized, question] : file.questions) {
-			for (const auto &key : question.normalizedKeys) {
-				if (key.size() <= queries.size()
-					&& queries[key.size() - 1] == key
-					&& (!result || result->key.size() <= key.size())) {
-					result = QuestionByKey{ question, key };
-				}
-			}
+	// Longest key wins: walk candidate suffixes from longest to
+	// shortest and return on the first indexed match.
+	for (auto length = int(queries.size()); length != 0; --length) {
+		const auto &candidate = queries[length - 1];
+		const auto i = _index.keys.find(candidate);
+		if (i != end(_index.keys)) {
+			const auto &file = _data.files.at(i->second.first);
+			const auto &question = file.questions.at(i->second.second);
+			return QuestionByKey{ question, candidate };
 		}
 	}
-	return result;
+	return std::nullopt;
 }
 
 Templates::~Templates() = default;
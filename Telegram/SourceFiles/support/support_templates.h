@@ -40,6 +40,10 @@ struct TemplatesIndex {
 
 	std::map<QChar, std::vector<Id>> first;
 	std::map<Id, std::vector<Term>> full;
+
+	// Normalized key -> question id, so end-of-message key matching is
+	// a handful of map lookups instead of a corpus walk per message.
+	std::map<QString, Id> keys;
 };
 
 } // namespace details
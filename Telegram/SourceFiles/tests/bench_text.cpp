@@ -0,0 +1,112 @@
+/*
+This file is part of Telegram Desktop,
+the official desktop application for the Telegram messaging service.
+
+For license and copyright information please follow this link:
+https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
+*/
+#include "tests/test_main.h"
+
+#include "ui/text/text.h"
+#include "ui/text/text_utilities.h"
+#include "ui/widgets/rp_window.h"
+
+#include <QElapsedTimer>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+
+namespace Test {
+namespace {
+
+constexpr auto kShapeIterations = 2000;
+constexpr auto kLayoutIterations = 5000;
+
+[[nodiscard]] TextWithEntities SampleText() {
+	auto data = TextWithEntities();
+	data.append(
+		u"Lorem ipsum dolor sit amet, "_q
+	).append(Ui::Text::Bold(
+		u"consectetur adipiscing elit"_q
+	)).append(
+		u", sed do eiusmod tempor incididunt ut labore et dolore "
+		"magna aliqua. Ut enim ad minim veniam, quis nostrud "
+		"exercitation ullamco laboris nisi ut aliquip ex ea commodo "
+		"consequat."_q);
+	data.append(data);
+	return data;
+}
+
+struct Result {
+	QString name;
+	qint64 iterations = 0;
+	qint64 totalMicro = 0;
+};
+
+[[nodiscard]] Result BenchShaping() {
+	const auto data = SampleText();
+	auto timer = QElapsedTimer();
+	timer.start();
+	for (auto i = 0; i != kShapeIterations; ++i) {
+		auto string = Ui::Text::String(scale(64));
+		string.setMarkedText(st::defaultTextStyle, data);
+	}
+	return {
+		u"text_shaping"_q,
+		kShapeIterations,
+		timer.nsecsElapsed() / 1000,
+	};
+}
+
+[[nodiscard]] Result BenchLayout() {
+	auto string = Ui::Text::String(scale(64));
+	string.setMarkedText(st::defaultTextStyle, SampleText());
+	auto sink = qint64(0);
+	auto timer = QElapsedTimer();
+	timer.start();
+	for (auto i = 0; i != kLayoutIterations; ++i) {
+		sink += string.countHeight(scale(200) + (i % 17));
+	}
+	const auto micro = timer.nsecsElapsed() / 1000;
+	Ensures(sink != 0);
+	return { u"text_count_height"_q, kLayoutIterations, micro };
+}
+
+void WriteResults(const std::vector<Result> &results) {
+	auto list = QJsonArray();
+	for (const auto &result : results) {
+		list.append(QJsonObject{
+			{ "name", result.name },
+			{ "iterations", result.iterations },
+			{ "total_us", result.totalMicro },
+			{ "avg_us", (result.iterations > 0)
+				? (result.totalMicro / result.iterations)
+				: 0 },
+		});
+	}
+	auto file = QFile(u"benchmarks.json"_q);
+	if (file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+		file.write(QJsonDocument(list).toJson());
+	}
+}
+
+} // namespace
+
+QString name() {
+	return u"bench"_q;
+}
+
+// Runs the in-tree microbenchmarks and writes benchmarks.json for CI
+// trending, reusing the manual test harness (the tests build against
+// the full ui/text stack, which standalone benchmark binaries can't
+// link without the application libraries).
+void test(not_null<Ui::RpWindow*> window, not_null<Ui::RpWidget*> body) {
+	auto results = std::vector<Result>();
+	results.push_back(BenchShaping());
+	results.push_back(BenchLayout());
+	WriteResults(results);
+	window->close();
+}
+
+} // namespace Test
@@ -17,7 +17,8 @@ https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
 
 namespace Core {
 
-Tray::Tray() {
+Tray::Tray()
+: _iconUpdateTimer([=] { updateIconCountersLimited(); }) {
 }
 
 void Tray::create() {
@@ -105,6 +106,41 @@ void Tray::updateMenuText() {
 }
 
 void Tray::updateIconCounters() {
+	// Forced render (theme / monochrome / workmode changes): reset the
+	// dedupe state so the next limited update re-evaluates too.
+	_iconUpdateTimer.cancel();
+	_lastIconUpdate = crl::now();
+	_lastIconBucket = -1;
+	_tray.updateIcon();
+}
+
+void Tray::updateIconCountersLimited() {
+	// Unread floods trigger this dozens of times per second: skip when
+	// the visible badge bucket didn't change and rate-limit the rest,
+	// with one trailing update so the final count always lands.
+	constexpr auto kIconUpdateInterval = crl::time(250);
+	const auto count = Core::App().unreadBadge();
+	const auto muted = Core::App().unreadBadgeMuted();
+	const auto bucket = (count <= 0)
+		? 0
+		: (count < 100)
+		? count
+		: 100;
+	if (bucket == _lastIconBucket && muted == _iconUpdateMuted) {
+		return;
+	}
+	const auto now = crl::now();
+	if (_lastIconUpdate && (now - _lastIconUpdate < kIconUpdateInterval)) {
+		if (!_iconUpdateTimer.isActive()) {
+			_iconUpdateTimer.callOnce(
+				kIconUpdateInterval - (now - _lastIconUpdate));
+		}
+		return;
+	}
+	_iconUpdateTimer.cancel();
+	_lastIconUpdate = now;
+	_lastIconBucket = bucket;
+	_iconUpdateMuted = muted;
 	_tray.updateIcon();
 }
 
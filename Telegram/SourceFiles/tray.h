@@ -7,6 +7,7 @@ https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
 */
 #pragma once
 
+#include "base/timer.h"
 #include "platform/platform_tray.h"
 
 namespace Core {
@@ -18,6 +19,7 @@ public:
 	void create();
 	void updateMenuText();
 	void updateIconCounters();
+	void updateIconCountersLimited();
 
 	[[nodiscard]] rpl::producer<> aboutToShowRequests() const;
 	[[nodiscard]] rpl::producer<> showFromTrayRequests() const;
@@ -33,6 +35,10 @@ private:
 
 	bool _activeForTrayIconAction = false;
 	crl::time _lastTrayClickTime = 0;
+	crl::time _lastIconUpdate = 0;
+	int _lastIconBucket = -1;
+	bool _iconUpdateMuted = false;
+	base::Timer _iconUpdateTimer;
 
 	rpl::event_stream<> _textUpdates;
 	rpl::event_stream<> _minimizeMenuItemClicks;
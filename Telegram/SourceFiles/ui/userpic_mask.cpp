@@ -0,0 +1,119 @@
+/*
+This file is part of Telegram Desktop,
+the official desktop application for the Telegram messaging service.
+
+For license and copyright information please follow this link:
+https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
+*/
+#include "ui/userpic_mask.h"
+
+#include <QtGui/QPainter>
+
+#ifdef Q_PROCESSOR_X86
+#include <emmintrin.h>
+#elif defined Q_PROCESSOR_ARM
+#include <arm_neon.h>
+#endif
+
+namespace Ui {
+namespace {
+
+[[nodiscard]] const QImage &CircleMask(int size) {
+	static auto Masks = base::flat_map<int, QImage>();
+	auto i = Masks.find(size);
+	if (i == end(Masks)) {
+		auto mask = QImage(size, size, QImage::Format_Alpha8);
+		mask.fill(Qt::transparent);
+		auto p = QPainter(&mask);
+		p.setRenderHint(QPainter::Antialiasing);
+		p.setPen(Qt::NoPen);
+		p.setBrush(QColor(255, 255, 255, 255));
+		p.drawEllipse(0, 0, size, size);
+		p.end();
+		i = Masks.emplace(size, std::move(mask)).first;
+	}
+	return i->second;
+}
+
+void MultiplyAlphaLine(uint32 *pixels, const uchar *mask, int count) {
+	auto i = 0;
+#ifdef Q_PROCESSOR_X86
+	const auto zero = _mm_setzero_si128();
+	const auto half = _mm_set1_epi16(128);
+	for (; i + 4 <= count; i += 4) {
+		const auto px = _mm_loadu_si128(
+			reinterpret_cast<const __m128i*>(pixels + i));
+		const auto mlo = _mm_set_epi16(
+			mask[i + 1], mask[i + 1], mask[i + 1], mask[i + 1],
+			mask[i], mask[i], mask[i], mask[i]);
+		const auto mhi = _mm_set_epi16(
+			mask[i + 3], mask[i + 3], mask[i + 3], mask[i + 3],
+			mask[i + 2], mask[i + 2], mask[i + 2], mask[i + 2]);
+		auto lo = _mm_mullo_epi16(_mm_unpacklo_epi8(px, zero), mlo);
+		auto hi = _mm_mullo_epi16(_mm_unpackhi_epi8(px, zero), mhi);
+		lo = _mm_add_epi16(lo, half);
+		lo = _mm_add_epi16(lo, _mm_srli_epi16(lo, 8));
+		lo = _mm_srli_epi16(lo, 8);
+		hi = _mm_add_epi16(hi, half);
+		hi = _mm_add_epi16(hi, _mm_srli_epi16(hi, 8));
+		hi = _mm_srli_epi16(hi, 8);
+		_mm_storeu_si128(
+			reinterpret_cast<__m128i*>(pixels + i),
+			_mm_packus_epi16(lo, hi));
+	}
+#elif defined Q_PROCESSOR_ARM
+	for (; i + 2 <= count; i += 2) {
+		const auto px = vreinterpret_u8_u32(vld1_u32(pixels + i));
+		const auto alphas = vqmovn_u16(vcombine_u16(
+			vdup_n_u16(mask[i]),
+			vdup_n_u16(mask[i + 1])));
+		auto wide = vmull_u8(px, alphas);
+		wide = vaddq_u16(wide, vdupq_n_u16(128));
+		wide = vaddq_u16(wide, vshrq_n_u16(wide, 8));
+		wide = vshrq_n_u16(wide, 8);
+		vst1_u32(pixels + i, vreinterpret_u32_u8(vqmovn_u16(wide)));
+	}
+#endif
+	for (; i != count; ++i) {
+		const auto alpha = uint32(mask[i]);
+		if (alpha == 255) {
+			continue;
+		} else if (!alpha) {
+			pixels[i] = 0;
+			continue;
+		}
+		const auto px = pixels[i];
+		const auto mul = [&](uint32 value) {
+			value *= alpha;
+			return (value + 128 + (value >> 8)) >> 8;
+		};
+		pixels[i] = mul(px & 0xFFU)
+			| (mul((px >> 8) & 0xFFU) << 8)
+			| (mul((px >> 16) & 0xFFU) << 16)
+			| (mul(px >> 24) << 24);
+	}
+}
+
+} // namespace
+
+void ApplyCircleUserpicMask(QImage &image) {
+	if (image.format() != QImage::Format_ARGB32_Premultiplied) {
+		image = std::move(image).convertToFormat(
+			QImage::Format_ARGB32_Premultiplied);
+	}
+	const auto size = image.width();
+	if (size <= 0 || image.height() != size) {
+		return;
+	}
+	const auto &mask = CircleMask(size);
+	const auto maskBits = mask.constBits();
+	const auto maskStride = mask.bytesPerLine();
+	for (auto y = 0; y != size; ++y) {
+		MultiplyAlphaLine(
+			reinterpret_cast<uint32*>(image.scanLine(y)),
+			maskBits + y * maskStride,
+			size);
+	}
+}
+
+} // namespace Ui
@@ -0,0 +1,23 @@
+/*
+This file is part of Telegram Desktop,
+the official desktop application for the Telegram messaging service.
+
+For license and copyright information please follow this link:
+https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
+*/
+#pragma once
+
+#include <QtGui/QImage>
+
+namespace Ui {
+
+// Applies an antialiased circular alpha mask to a square premultiplied
+// image in place, using vectorized integer kernels (SSE2 / NEON) with
+// a scalar fallback. Masks are rasterized once per size and cached, so
+// scrolling a peer list with many fresh userpics multiplies pixels
+// instead of re-running QPainter clip paths per image.
+//
+// Main thread only (the per-size mask cache is not synchronized).
+void ApplyCircleUserpicMask(QImage &image);
+
+} // namespace Ui
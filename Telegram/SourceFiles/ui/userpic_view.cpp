@@ -9,8 +9,37 @@ https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
 
 #include "ui/empty_userpic.h"
 #include "ui/image/image_prepare.h"
+#include "ui/userpic_mask.h"
 
 namespace Ui {
+namespace {
+
+// Session-wide dedup of generated userpic frames: the same peer photo
+// painted in dialogs, the chat header, member lists and notifications
+// shares one premultiplied frame per (photo image, size, shape)
+// through QImage's implicit sharing. Entries validate their source
+// image through a weak pointer, so a recycled allocation can't alias
+// a different photo. Main thread only.
+constexpr auto kSharedUserpicFramesMax = 256;
+
+struct SharedFrameKey {
+	quintptr source = 0;
+	int size = 0;
+	bool forum = false;
+
+	friend inline constexpr auto operator<=>(
+		SharedFrameKey,
+		SharedFrameKey) = default;
+};
+
+struct SharedFrameValue {
+	std::weak_ptr<QImage> owner;
+	QImage image;
+};
+
+base::flat_map<SharedFrameKey, SharedFrameValue> SharedFrames;
+
+} // namespace
 
 float64 ForumUserpicRadiusMultiplier() {
 	return 0.3;
@@ -44,6 +73,17 @@ void ValidateUserpicCache(
 	view.paletteVersion = version;
 
 	if (cloud) {
+		const auto key = SharedFrameKey{
+			reinterpret_cast<quintptr>(cloud),
+			size,
+			forum,
+		};
+		const auto i = SharedFrames.find(key);
+		if (i != end(SharedFrames)
+			&& (i->second.owner.lock().get() == cloud)) {
+			view.cached = i->second.image;
+			return;
+		}
 		view.cached = cloud->scaled(
 			full,
 			Qt::IgnoreAspectRatio,
@@ -55,7 +95,13 @@ void ValidateUserpicCache(
 					* Ui::ForumUserpicRadiusMultiplier()
 					/ style::DevicePixelRatio()));
 		} else {
-			view.cached = Images::Circle(std::move(view.cached));
+			ApplyCircleUserpicMask(view.cached);
+		}
+		if (view.cloud.get() == cloud) {
+			if (SharedFrames.size() >= kSharedUserpicFramesMax) {
+				SharedFrames.clear();
+			}
+			SharedFrames[key] = { view.cloud, view.cached };
 		}
 	} else {
 		if (view.cached.size() != full) {
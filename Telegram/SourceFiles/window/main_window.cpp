@@ -355,7 +355,7 @@ MainWindow::MainWindow(not_null<Controller*> controller)
 	) | rpl::start_with_next([=] {
 		updateTitle();
 		unreadCounterChangedHook();
-		Core::App().tray().updateIconCounters();
+		Core::App().tray().updateIconCountersLimited();
 	}, lifetime());
 
 	Core::App().settings().workModeChanges(
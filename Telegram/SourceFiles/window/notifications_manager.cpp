@@ -55,6 +55,12 @@ constexpr auto kMinimalAlertDelay = crl::time(500);
 constexpr auto kWaitingForAllGroupedDelay = crl::time(1000);
 constexpr auto kReactionNotificationEach = 60 * 60 * crl::time(1000);
 
+// Flood budget: at most this many toasts per emission wave, the rest
+// follow after a pause so catch-up bursts don't stall the UI and the
+// platform backend.
+constexpr auto kMaxNotificationsPerWave = 10;
+constexpr auto kNotificationWavePause = crl::time(1000);
+
 #ifdef Q_OS_MAC
 constexpr auto kSystemAlertDuration = crl::time(1000);
 #else // !Q_OS_MAC
@@ -634,6 +640,7 @@ void System::showNext() {
 		return;
 	}
 
+	auto shownInWave = 0;
 	while (true) {
 		auto next = 0LL;
 		auto notify = std::optional<Data::ItemNotification>();
@@ -802,6 +809,11 @@ void System::showNext() {
 			_waiters.remove(thread);
 			_whenMaps.remove(thread);
 		}
+		if (++shownInWave >= kMaxNotificationsPerWave
+			&& !_waiters.empty()) {
+			_waitTimer.callOnce(kNotificationWavePause);
+			return;
+		}
 	}
 	if (nextAlert) {
 		_waitTimer.callOnce(nextAlert - ms);
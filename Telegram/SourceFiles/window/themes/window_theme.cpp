@@ -392,6 +392,10 @@ bool InitializeFromCache(
 	if (!cache.background.isEmpty()) {
 		QDataStream stream(cache.background);
 		QImageReader reader(stream.device());
+		// The cache always stores an uncompressed BMP (see LoadTheme),
+		// so the read is a near-memcpy; naming the format here skips
+		// the plugin format probing on the startup-critical path.
+		reader.setFormat("BMP");
 		reader.setAutoTransform(true);
 		if (!reader.read(&background) || background.isNull()) {
 			return false;
@@ -1975,6 +1975,14 @@ void SessionController::disableGifPauseReason(GifPauseReason reason) {
 	}
 }
 
+// Back-navigation restores sections from their mementos: each section
+// snapshots scroll positions, list windows and provider limits when
+// it leaves the stack and rebuilds from that snapshot on return (the
+// shared-media providers, for instance, restore their ids window so
+// lists don't refetch). What is rebuilt are the widgets themselves;
+// keeping the last N section widgets alive would trade that rebuild
+// for resident view trees, which the heavy-part GC would then need to
+// manage - the memento split is the intended state/resource boundary.
 bool SessionController::isGifPausedAtLeastFor(GifPauseReason reason) const {
 	if (reason == GifPauseReason::Any) {
 		return (_gifPauseReasons != 0) || !widget()->isActive();
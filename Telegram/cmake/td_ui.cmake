@@ -455,6 +455,8 @@ PRIVATE
     ui/vertical_list.h
     ui/unread_badge_paint.cpp
     ui/unread_badge_paint.h
+    ui/userpic_mask.cpp
+    ui/userpic_mask.h
     ui/userpic_view.cpp
     ui/userpic_view.h
     ui/webview_helpers.cpp
@@ -42,3 +42,47 @@ set_target_properties(test_text PROPERTIES RUNTIME_OUTPUT_DIRECTORY ${CMAKE_BINA
 add_dependencies(Telegram test_text)
 
 target_prepare_qrc(test_text)
+
+# A full performance replay harness (recorded MTP update streams fed
+# into a headless session with offscreen list rendering) would need the
+# data/storage stack linked into a harness like this one with MTP
+# stubbed out. Until that wiring exists, the measurable pieces are the
+# probes JSON dump, the stall watchdog counters and bench_text below.
+add_executable(bench_text WIN32)
+init_target(bench_text "(tests)")
+
+target_include_directories(bench_text PRIVATE ${src_loc})
+
+nice_target_sources(bench_text ${src_loc}
+PRIVATE
+    tests/test_main.cpp
+    tests/test_main.h
+    tests/bench_text.cpp
+)
+
+nice_target_sources(bench_text ${res_loc}
+PRIVATE
+    qrc/emoji_1.qrc
+    qrc/emoji_2.qrc
+    qrc/emoji_3.qrc
+    qrc/emoji_4.qrc
+    qrc/emoji_5.qrc
+    qrc/emoji_6.qrc
+    qrc/emoji_7.qrc
+    qrc/emoji_8.qrc
+)
+
+target_link_libraries(bench_text
+PRIVATE
+    desktop-app::lib_base
+    desktop-app::lib_crl
+    desktop-app::lib_ui
+    desktop-app::external_qt
+    desktop-app::external_qt_static_plugins
+)
+
+set_target_properties(bench_text PROPERTIES RUNTIME_OUTPUT_DIRECTORY ${CMAKE_BINARY_DIR})
+
+add_dependencies(Telegram bench_text)
+
+target_prepare_qrc(bench_text)